@@ -0,0 +1,171 @@
+#! /bin/sh
+
+# Generates the two-stage code point property table in src/chartypes.h from src/chartypes.in
+#
+# Each code point gets one 16 bit entry: its CHARTYPE in bits 0-5, whether it is weighted
+# in bit 6, whether it splits tokens in bit 7, the token type it starts in bits 8-12 and
+# its NFC_Quick_Check value in bits 13-14.
+# Code points are split into blocks of 2^BLOCK_SHIFT entries and identical blocks are only
+# stored once, so CHAR_PROPS_BLOCKS maps the upper bits of a code point to its block.
+
+BLOCK_SHIFT=8
+
+LC_ALL=C awk -v block_shift="${BLOCK_SHIFT}" '
+function hex(s,    i, n) {
+  n = 0
+  s = tolower(substr(s, 3))
+  for (i = 1; i <= length(s); i ++) {
+    n = n * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+  }
+  return n
+}
+
+function add_rule(kind, first, last, value) {
+  n_rules ++
+  rule_kind[n_rules] = kind
+  rule_first[n_rules] = hex(first)
+  rule_last[n_rules] = hex(last)
+  rule_value[n_rules] = value
+}
+
+BEGIN { n_chartypes = 0; n_tokentypes = 0; n_rules = 0; n_unique_blocks = 0 }
+
+/^#/ || NF == 0 { next }
+$1 == "tokentype" { n_tokentypes ++; tokentypes[n_tokentypes] = $2; tokentype_value[$2] = n_tokentypes; next }
+$1 == "chartype" { chartypes[n_chartypes] = $2; chartype_value[$2] = n_chartypes; n_chartypes ++; next }
+$1 == "token" { add_rule("token", $2, $3, $4); next }
+$1 == "split" { add_rule("split", $2, $3, ""); next }
+$1 == "unweighted" { add_rule("unweighted", $2, $3, ""); next }
+$1 == "range" { add_rule("range", $2, $3, $4); next }
+$1 == "default" { default_chartype = $2; next }
+$1 == "nfc_qc" && ($4 == "No" || $4 == "Maybe") { add_rule("nfc_qc", $2, $3, $4); next }
+{ printf "chartypes.in:%d: unknown line \"%s\"\n", NR, $0 > "/dev/stderr"; exit 1 }
+
+END {
+  if (n_chartypes > 64 || n_tokentypes > 31) {
+    print "Too many character or token types to fit in the table" > "/dev/stderr"
+    exit 1
+  }
+
+  for (i = 1; i <= n_rules; i ++) {
+    if (rule_kind[i] == "range" && !(rule_value[i] in chartype_value) ||
+        rule_kind[i] == "token" && !(rule_value[i] in tokentype_value)) {
+      printf "Unknown type %s\n", rule_value[i] > "/dev/stderr"
+      exit 1
+    }
+  }
+
+  block_size = 2 ^ block_shift
+  # Code points go up to U+10FFFF
+  n_blocks = 1114112 / block_size
+
+  for (block = 0; block < n_blocks; block ++) {
+    block_start = block * block_size
+    block_end = block_start + block_size - 1
+
+    # Only check the rules that touch this block
+    n_block_rules = 0
+    for (i = 1; i <= n_rules; i ++) {
+      if (rule_first[i] <= block_end && rule_last[i] >= block_start) {
+        block_rules[++ n_block_rules] = i
+      }
+    }
+
+    key = ""
+    for (c = block_start; c <= block_end; c ++) {
+      chartype = ""
+      tokentype = tokentype_value["TEXT"]
+      weighted = 64
+      splits = 0
+      nfc_qc = 0
+
+      for (j = 1; j <= n_block_rules; j ++) {
+        i = block_rules[j]
+        if (c < rule_first[i] || c > rule_last[i]) {
+          continue
+        }
+
+        if (rule_kind[i] == "range" && chartype == "") {
+          chartype = chartype_value[rule_value[i]]
+        } else if (rule_kind[i] == "token") {
+          tokentype = tokentype_value[rule_value[i]]
+        } else if (rule_kind[i] == "split") {
+          splits = 128
+        } else if (rule_kind[i] == "unweighted") {
+          weighted = 0
+        } else if (rule_kind[i] == "nfc_qc") {
+          nfc_qc = rule_value[i] == "No" ? 8192 : 16384
+        }
+      }
+
+      if (chartype == "") {
+        chartype = chartype_value[default_chartype]
+      }
+
+      key = key sprintf("0x%04X,", nfc_qc + tokentype * 256 + splits + weighted + chartype)
+    }
+
+    if (!(key in block_index)) {
+      block_index[key] = n_unique_blocks
+      unique_blocks[n_unique_blocks] = key
+      n_unique_blocks ++
+    }
+    blocks[block] = block_index[key]
+  }
+
+  if (n_unique_blocks > 256) {
+    print "Too many distinct blocks for CHAR_PROPS_BLOCKS" > "/dev/stderr"
+    exit 1
+  }
+
+  print "/* Generated by generate-chartypes.sh from chartypes.in, do not edit */"
+  print ""
+  print "#ifndef __TL_CHARTYPES_H__"
+  print "#define __TL_CHARTYPES_H__"
+  print ""
+  print "enum {"
+  for (i = 1; i <= n_tokentypes; i ++) {
+    printf "  TOK_%s%s,\n", tokentypes[i], i == 1 ? " = 1" : ""
+  }
+  print "};"
+  print ""
+  print "enum {"
+  for (i = 0; i < n_chartypes; i ++) {
+    printf "  CHARTYPE_%s,\n", chartypes[i]
+  }
+  print "  N_CHARTYPES"
+  print "};"
+  print ""
+  print "#define CHAR_PROPS_CHARTYPE(props)   ((props) & 0x3F)"
+  print "#define CHAR_PROPS_WEIGHTED          0x40"
+  print "#define CHAR_PROPS_SPLITS            0x80"
+  print "#define CHAR_PROPS_TOKEN_TYPE(props) (((props) >> 8) & 0x1F)"
+  print "#define CHAR_PROPS_NFC_NO            0x2000"
+  print "#define CHAR_PROPS_NFC_MAYBE         0x4000"
+  print ""
+  print "// Properties of anything past U+10FFFF, which is what invalid UTF-8 can decode to"
+  printf "#define CHAR_PROPS_INVALID 0x%04X\n", tokentype_value["TEXT"] * 256 + 64 + chartype_value[default_chartype]
+  print ""
+  printf "#define CHAR_PROPS_BLOCK_SHIFT %d\n", block_shift
+  printf "#define CHAR_PROPS_BLOCK_MASK  0x%X\n", block_size - 1
+  print ""
+  printf "static const unsigned char CHAR_PROPS_BLOCKS[%d] = {\n", n_blocks
+  for (block = 0; block < n_blocks; block ++) {
+    printf "%s%3d,%s", block % 16 == 0 ? "  " : " ", blocks[block], block % 16 == 15 ? "\n" : ""
+  }
+  print "};"
+  print ""
+  printf "static const unsigned short CHAR_PROPS[%d][%d] = {\n", n_unique_blocks, block_size
+  for (i = 0; i < n_unique_blocks; i ++) {
+    print "  {"
+    n = split(unique_blocks[i], values, ",")
+    for (j = 1; j < n; j ++) {
+      printf "%s%s,%s", (j - 1) % 8 == 0 ? "    " : " ", values[j], (j - 1) % 8 == 7 ? "\n" : ""
+    }
+    print "  },"
+  }
+  print "};"
+  print ""
+  print "#endif"
+}
+' src/chartypes.in > src/chartypes.h
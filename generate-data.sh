@@ -1,17 +1,18 @@
 #! /bin/sh
 
-output_line() {
-    tld=$1
-    char_count=$(echo -n "$tld" | wc -m)
-    echo "  {${char_count}, \"${tld}\"},"
-}
-
 tlds_file=$(mktemp --suffix=.yml --tmpdir tlds-XXXX)
-cctlds_file=$(mktemp --suffix=.in --tmpdir cctlds-XXXX)
-gtlds_file=$(mktemp --suffix=.in --tmpdir gtlds-XXXX)
-trap "rm -f ${tlds_file} ${cctlds_file} ${gtlds_file}" 0 2 3 15
+sorted_file=$(mktemp --suffix=.in --tmpdir sorted-tlds-XXXX)
+trap "rm -f ${tlds_file} ${sorted_file}" 0 2 3 15
 
 curl -L -o "${tlds_file}" https://github.com/twitter/twitter-text/raw/master/conformance/tlds.yml
-grep "is a valid country tld" "${tlds_file}" | awk '{print $3}' | while read tld; do output_line $tld; done | sort -k1.4n,2 > "${cctlds_file}"
-grep "is a valid generic tld" "${tlds_file}" | awk '{print $3}' | while read tld; do output_line $tld; done | sort -k1.4n,2 > "${gtlds_file}"
-cat src/data.h.in.1 "${gtlds_file}" src/data.h.in.2 "${cctlds_file}" src/data.h.in.3 > src/data.h
\ No newline at end of file
+# token_is_tld() binary searches the TLDs of one length, so sort by length in bytes and then byte value
+grep -E "is a valid (country|generic) tld" "${tlds_file}" | awk '{print $3}' | LC_ALL=C awk '{print length($0), $0}' | LC_ALL=C sort -k1,1n -k2,2 > "${sorted_file}"
+
+{
+  cat src/data.h.in.1
+  awk '{printf "  \"%s\",\n", $2}' "${sorted_file}"
+  cat src/data.h.in.2
+  # One offset for every length from 0 up to the longest TLD, plus the end of the list
+  awk '{while (len <= $1) {printf "  %d,\n", NR - 1; len ++}} END {printf "  %d,\n", NR}' "${sorted_file}"
+  cat src/data.h.in.3
+} > src/data.h
@@ -17,457 +17,517 @@
 
 #include "libtweetlength.h"
 #include "data.h"
+#include "chartypes.h"
 #include <string.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #define LINK_LENGTH 23
 #define UNWEIGHTED_VALUE 1
 #define WEIGHTED_VALUE 2
 #define END_SEQUENCE_WEIGHT 0
 #define REGIONAL_INDICATOR_OFFSET 0x1F1E6
-#define MAKE_KEY(prev_char, cur_char) GUINT_TO_POINTER(prev_char + (cur_char << 8))
-
-// Map of current character type to a list of potential replacements based on the previous character
-GHashTable *chartype_map;
-// Lookup table of valid Regional Indicator strings
-gboolean valid_ri_strings[26*26];
-gboolean ri_validator_generated = FALSE;
+#define TLD_MAX_LENGTH (G_N_ELEMENTS (TLD_OFFSETS) - 2)
+
+// Bitmap of valid Regional Indicator pairs, indexed by the first letter with one bit per second letter.
+// Codes taken from https://en.wikipedia.org/wiki/Regional_indicator_symbol, including the
+// deleted codes AN BU CS DD FX NT QU SU TP YD YU ZR.
+#define RI_ROW(c) ((c) - 'A')
+#define RI_BIT(c) (1u << ((c) - 'A'))
+static const guint32 valid_ri_pairs[26] = {
+  [RI_ROW ('A')] = RI_BIT ('C') | RI_BIT ('D') | RI_BIT ('E') | RI_BIT ('F') | RI_BIT ('G') |
+    RI_BIT ('I') | RI_BIT ('L') | RI_BIT ('M') | RI_BIT ('N') | RI_BIT ('O') | RI_BIT ('Q') |
+    RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('T') | RI_BIT ('U') | RI_BIT ('W') | RI_BIT ('X') |
+    RI_BIT ('Z'),
+  [RI_ROW ('B')] = RI_BIT ('A') | RI_BIT ('B') | RI_BIT ('D') | RI_BIT ('E') | RI_BIT ('F') |
+    RI_BIT ('G') | RI_BIT ('H') | RI_BIT ('I') | RI_BIT ('J') | RI_BIT ('L') | RI_BIT ('M') |
+    RI_BIT ('N') | RI_BIT ('O') | RI_BIT ('Q') | RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('T') |
+    RI_BIT ('U') | RI_BIT ('V') | RI_BIT ('W') | RI_BIT ('Y') | RI_BIT ('Z'),
+  [RI_ROW ('C')] = RI_BIT ('A') | RI_BIT ('C') | RI_BIT ('D') | RI_BIT ('F') | RI_BIT ('G') |
+    RI_BIT ('H') | RI_BIT ('I') | RI_BIT ('K') | RI_BIT ('L') | RI_BIT ('M') | RI_BIT ('N') |
+    RI_BIT ('O') | RI_BIT ('P') | RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('U') | RI_BIT ('V') |
+    RI_BIT ('W') | RI_BIT ('X') | RI_BIT ('Y') | RI_BIT ('Z'),
+  [RI_ROW ('D')] = RI_BIT ('D') | RI_BIT ('E') | RI_BIT ('G') | RI_BIT ('J') | RI_BIT ('K') |
+    RI_BIT ('M') | RI_BIT ('O') | RI_BIT ('Z'),
+  [RI_ROW ('E')] = RI_BIT ('A') | RI_BIT ('C') | RI_BIT ('E') | RI_BIT ('G') | RI_BIT ('H') |
+    RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('T') | RI_BIT ('U'),
+  [RI_ROW ('F')] = RI_BIT ('I') | RI_BIT ('J') | RI_BIT ('K') | RI_BIT ('M') | RI_BIT ('O') |
+    RI_BIT ('R') | RI_BIT ('X'),
+  [RI_ROW ('G')] = RI_BIT ('A') | RI_BIT ('B') | RI_BIT ('D') | RI_BIT ('E') | RI_BIT ('F') |
+    RI_BIT ('G') | RI_BIT ('H') | RI_BIT ('I') | RI_BIT ('L') | RI_BIT ('M') | RI_BIT ('N') |
+    RI_BIT ('P') | RI_BIT ('Q') | RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('T') | RI_BIT ('U') |
+    RI_BIT ('W') | RI_BIT ('Y'),
+  [RI_ROW ('H')] = RI_BIT ('K') | RI_BIT ('M') | RI_BIT ('N') | RI_BIT ('R') | RI_BIT ('T') |
+    RI_BIT ('U'),
+  [RI_ROW ('I')] = RI_BIT ('C') | RI_BIT ('D') | RI_BIT ('E') | RI_BIT ('L') | RI_BIT ('M') |
+    RI_BIT ('N') | RI_BIT ('O') | RI_BIT ('Q') | RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('T'),
+  [RI_ROW ('J')] = RI_BIT ('E') | RI_BIT ('M') | RI_BIT ('O') | RI_BIT ('P'),
+  [RI_ROW ('K')] = RI_BIT ('E') | RI_BIT ('G') | RI_BIT ('H') | RI_BIT ('I') | RI_BIT ('M') |
+    RI_BIT ('N') | RI_BIT ('P') | RI_BIT ('R') | RI_BIT ('W') | RI_BIT ('Y') | RI_BIT ('Z'),
+  [RI_ROW ('L')] = RI_BIT ('A') | RI_BIT ('B') | RI_BIT ('C') | RI_BIT ('I') | RI_BIT ('K') |
+    RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('T') | RI_BIT ('U') | RI_BIT ('V') | RI_BIT ('Y'),
+  [RI_ROW ('M')] = RI_BIT ('A') | RI_BIT ('C') | RI_BIT ('D') | RI_BIT ('E') | RI_BIT ('F') |
+    RI_BIT ('G') | RI_BIT ('H') | RI_BIT ('K') | RI_BIT ('L') | RI_BIT ('M') | RI_BIT ('N') |
+    RI_BIT ('O') | RI_BIT ('P') | RI_BIT ('Q') | RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('T') |
+    RI_BIT ('U') | RI_BIT ('V') | RI_BIT ('W') | RI_BIT ('X') | RI_BIT ('Y') | RI_BIT ('Z'),
+  [RI_ROW ('N')] = RI_BIT ('A') | RI_BIT ('C') | RI_BIT ('E') | RI_BIT ('F') | RI_BIT ('G') |
+    RI_BIT ('I') | RI_BIT ('L') | RI_BIT ('O') | RI_BIT ('P') | RI_BIT ('R') | RI_BIT ('T') |
+    RI_BIT ('U') | RI_BIT ('Z'),
+  [RI_ROW ('O')] = RI_BIT ('M'),
+  [RI_ROW ('P')] = RI_BIT ('A') | RI_BIT ('E') | RI_BIT ('F') | RI_BIT ('G') | RI_BIT ('H') |
+    RI_BIT ('K') | RI_BIT ('L') | RI_BIT ('M') | RI_BIT ('N') | RI_BIT ('R') | RI_BIT ('S') |
+    RI_BIT ('T') | RI_BIT ('W') | RI_BIT ('Y'),
+  [RI_ROW ('Q')] = RI_BIT ('A') | RI_BIT ('U'),
+  [RI_ROW ('R')] = RI_BIT ('E') | RI_BIT ('O') | RI_BIT ('S') | RI_BIT ('U') | RI_BIT ('W'),
+  [RI_ROW ('S')] = RI_BIT ('A') | RI_BIT ('B') | RI_BIT ('C') | RI_BIT ('D') | RI_BIT ('E') |
+    RI_BIT ('G') | RI_BIT ('H') | RI_BIT ('I') | RI_BIT ('J') | RI_BIT ('K') | RI_BIT ('L') |
+    RI_BIT ('M') | RI_BIT ('N') | RI_BIT ('O') | RI_BIT ('R') | RI_BIT ('S') | RI_BIT ('T') |
+    RI_BIT ('U') | RI_BIT ('V') | RI_BIT ('X') | RI_BIT ('Y') | RI_BIT ('Z'),
+  [RI_ROW ('T')] = RI_BIT ('A') | RI_BIT ('C') | RI_BIT ('D') | RI_BIT ('F') | RI_BIT ('G') |
+    RI_BIT ('H') | RI_BIT ('J') | RI_BIT ('K') | RI_BIT ('L') | RI_BIT ('M') | RI_BIT ('N') |
+    RI_BIT ('O') | RI_BIT ('P') | RI_BIT ('R') | RI_BIT ('T') | RI_BIT ('V') | RI_BIT ('W') |
+    RI_BIT ('Z'),
+  [RI_ROW ('U')] = RI_BIT ('A') | RI_BIT ('G') | RI_BIT ('M') | RI_BIT ('N') | RI_BIT ('S') |
+    RI_BIT ('Y') | RI_BIT ('Z'),
+  [RI_ROW ('V')] = RI_BIT ('A') | RI_BIT ('C') | RI_BIT ('E') | RI_BIT ('G') | RI_BIT ('I') |
+    RI_BIT ('N') | RI_BIT ('U'),
+  [RI_ROW ('W')] = RI_BIT ('F') | RI_BIT ('S'),
+  [RI_ROW ('X')] = RI_BIT ('K'),
+  [RI_ROW ('Y')] = RI_BIT ('D') | RI_BIT ('E') | RI_BIT ('T') | RI_BIT ('U'),
+  [RI_ROW ('Z')] = RI_BIT ('A') | RI_BIT ('M') | RI_BIT ('R') | RI_BIT ('W'),
+};
+#undef RI_ROW
+#undef RI_BIT
 
+/*
+ * The tokens of a text, as parallel arrays. Tokens follow each other without
+ * gaps, so the lengths of token i are the differences between its offsets and
+ * those of token i + 1. That is why every offset array has one more entry than
+ * there are tokens. @types and @classes also have one more entry, which is
+ * always 0, so looking one token past the end is fine.
+ *
+ * All offsets are 32 bits wide, so the tokens of one text can't span more
+ * than 4 GiB. The public functions refuse longer texts. Byte, character and
+ * UTF-16 offsets are relative to @input, @character_base and @utf16_base,
+ * weighted offsets are only ever subtracted from each other.
+ */
 typedef struct {
-  guint type;
-  const char *start;
-  gsize start_character_index;
-  gsize length_in_bytes;
-  gsize length_in_characters;
-  gsize length_in_weighted_characters;
-} Token;
+  const char *input;
+  gsize character_base;
+  gsize utf16_base;
+  guint32 *byte_offsets;
+  guint32 *character_offsets;
+  // In UTF-16 code units, which is the character offset plus the number of characters outside the BMP
+  guint32 *utf16_offsets;
+  guint32 *weighted_offsets;
+  // Weighted offsets without compacting emoji, same as @weighted_offsets unless the tokenizer compacts them
+  guint32 *plain_weighted_offsets;
+  guint8 *types;
+  // BYTE_CLASSES of single byte tokens, and the TC_ASCII and TC_ENDS_IN_ACCENTED flags
+  guint16 *classes;
+  gsize len;
+  // Number of entries the arrays have room for, including the one past the last token
+  gsize allocated;
+} Tokens;
+
+static inline const char *
+token_start (const Tokens *tokens,
+             gsize         i)
+{
+  return tokens->input + tokens->byte_offsets[i];
+}
 
-#ifdef LIBTL_DEBUG
-static char * G_GNUC_UNUSED
-token_str (const Token *t)
+static inline gsize
+token_start_character_index (const Tokens *tokens,
+                             gsize         i)
 {
-  return g_strdup_printf ("Type: %u, Text: '%.*s'", t->type, (int)t->length_in_bytes, t->start);
+  return tokens->character_base + tokens->character_offsets[i];
 }
 
-static char * G_GNUC_UNUSED
-entity_str (const TlEntity *e)
+static inline gsize
+token_start_utf16_index (const Tokens *tokens,
+                         gsize         i)
 {
-  return g_strdup_printf ("Type: %u, Text: '%.*s'", e->type, (int)e->length_in_bytes, e->start);
+  return tokens->utf16_base + tokens->utf16_offsets[i];
 }
 
-#endif
+static inline gsize
+token_length_in_bytes (const Tokens *tokens,
+                       gsize         i)
+{
+  return tokens->byte_offsets[i + 1] - tokens->byte_offsets[i];
+}
 
-enum {
-  TOK_TEXT = 1,
-  TOK_NUMBER,
-  TOK_WHITESPACE,
-  TOK_COLON,
-  TOK_SLASH,
-  TOK_OPEN_PAREN,
-  TOK_CLOSE_PAREN,
-  TOK_QUESTIONMARK,
-  TOK_DOT,
-  TOK_HASH,
-  TOK_AT,
-  TOK_EQUALS,
-  TOK_DASH,
-  TOK_UNDERSCORE,
-  TOK_APOSTROPHE,
-  TOK_QUOTE,
-  TOK_DOLLAR,
-  TOK_AMPERSAND,
-  TOK_EXCLAMATION,
-  TOK_TILDE
-};
+static inline gsize
+token_length_in_characters (const Tokens *tokens,
+                            gsize         i)
+{
+  return tokens->character_offsets[i + 1] - tokens->character_offsets[i];
+}
+
+static inline gsize
+token_length_in_weighted_characters (const Tokens *tokens,
+                                     gsize         i)
+{
+  return (guint32)(tokens->weighted_offsets[i + 1] - tokens->weighted_offsets[i]);
+}
 
+// Token flags, next to the BYTE_CLASSES bits
 enum {
-  CHARTYPE_NONE, // Used for initial setup ("none") and other special situations (Fitzpatrick modifier on its own)
-  CHARTYPE_UNWEIGHTED,
-  CHARTYPE_KEYCAPPABLE,
-  CHARTYPE_WEIGHTED_OTHER,
-  CHARTYPE_FITZPATRICK,
-  CHARTYPE_WOMAN,
-  CHARTYPE_MAN,
-  CHARTYPE_UNGENDERED_ADULT,
-  CHARTYPE_CHILD,
-  CHARTYPE_FAMILY_PARENTS,
-  CHARTYPE_FAMILY_1_CHILD,
-  CHARTYPE_FAMILY_2_CHILD,
-  CHARTYPE_PERSON,
-  CHARTYPE_GENDERABLE_PERSON,
-  CHARTYPE_UNTONED_GENDERABLE_PERSON,
-  CHARTYPE_FITZPATRICKED_PERSON,
-  CHARTYPE_FITZPATRICKED_GENDERABLE_PERSON,
-  CHARTYPE_FITZPATRICKED_ADULT,
-  CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT,
-  CHARTYPE_HAIRSTYLE,
-  CHARTYPE_HAIRSTYLED_ADULT,
-  CHARTYPE_JOB,
-  CHARTYPE_JOB_TEXT,
-  CHARTYPE_JOB_PERSON_TEXT,
-  CHARTYPE_JOB_PERSON,
-  CHARTYPE_WHITE_FLAG,
-  CHARTYPE_WHITE_FLAG_VS16,
-  CHARTYPE_BLACK_FLAG,
-  CHARTYPE_GENDER_TEXT,
-  CHARTYPE_GENDER,
-  CHARTYPE_GENDERED_PERSON_TEXT,
-  CHARTYPE_GENDERED_PERSON,
-  CHARTYPE_HAIR,
-  CHARTYPE_HEART,
-  CHARTYPE_LOVE_BASE_TEXT,
-  CHARTYPE_LOVE_BASE,
-  CHARTYPE_LOVE_BASE_TEXT_POSSIBLE,
-  CHARTYPE_LOVE_BASE_POSSIBLE,
-  CHARTYPE_LOVE,
-  CHARTYPE_KISS_MARK,
-  CHARTYPE_KISSING_BASE,
-  CHARTYPE_KISSING_BASE_POSSIBLE,
-  CHARTYPE_KISSING,
-  CHARTYPE_RAINBOW,
-  CHARTYPE_TRANSGENDER_SYMBOL,
-  CHARTYPE_SKULL_AND_CROSSBONES,
-  CHARTYPE_PARTIAL_COMBINED_FLAG,
-  CHARTYPE_COMBINED_FLAG,
-  CHARTYPE_CHRISTMAS_TREE,
-  CHARTYPE_DOG,
-  CHARTYPE_SAFETY_VEST,
-  CHARTYPE_CAT,
-  CHARTYPE_COLOUR_BLACK,
-  CHARTYPE_BEAR,
-  CHARTYPE_SNOWFLAKE,
-  CHARTYPE_ZWJ_ANIMAL_TEXT,
-  CHARTYPE_ZWJ_ANIMAL,
-  CHARTYPE_REGIONAL_INDICATOR,
-  CHARTYPE_REGIONAL_INDICATOR_FLAG,
-  CHARTYPE_TAG,
-  CHARTYPE_TAGGED_FLAG,
-  CHARTYPE_TAG_CLOSE,
-  CHARTYPE_VS16,
-  CHARTYPE_ZWJ
+  TC_ASCII            = 1 << 10,
+  // The token is text of more than one byte and its last character isn't ASCII
+  TC_ENDS_IN_ACCENTED = 1 << 11,
 };
 
-typedef struct _CharTypeOption {
-  guint8 new_chartype;
-  guint8 carry_weight;
-} CharTypeOption;
-
-static inline CharTypeOption*
-new_chartypeoption(guint new_chartype, guint carry_weight) {
-  CharTypeOption *opt = malloc(sizeof(CharTypeOption));
-  opt->new_chartype = new_chartype;
-  opt->carry_weight = carry_weight;
-  return opt;
-}
-
-static inline GHashTable*
-get_chartype_options ()
-{
-  if (chartype_map != NULL) {
-    return chartype_map;
-  }
-
-  chartype_map = g_hash_table_new(g_direct_hash, g_direct_equal);
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WOMAN, CHARTYPE_WOMAN), new_chartypeoption(CHARTYPE_FAMILY_PARENTS, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_MAN, CHARTYPE_MAN), new_chartypeoption(CHARTYPE_FAMILY_PARENTS, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_MAN, CHARTYPE_WOMAN), new_chartypeoption(CHARTYPE_FAMILY_PARENTS, WEIGHTED_VALUE));
-  // But not Woman then Man for the family
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WOMAN, CHARTYPE_CHILD), new_chartypeoption(CHARTYPE_FAMILY_1_CHILD, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_MAN, CHARTYPE_CHILD), new_chartypeoption(CHARTYPE_FAMILY_1_CHILD, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FAMILY_PARENTS, CHARTYPE_CHILD), new_chartypeoption(CHARTYPE_FAMILY_1_CHILD, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FAMILY_1_CHILD, CHARTYPE_CHILD), new_chartypeoption(CHARTYPE_FAMILY_2_CHILD, END_SEQUENCE_WEIGHT));
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WOMAN, CHARTYPE_JOB_TEXT), new_chartypeoption(CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_MAN, CHARTYPE_JOB_TEXT), new_chartypeoption(CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_UNGENDERED_ADULT, CHARTYPE_JOB_TEXT), new_chartypeoption(CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_ADULT, CHARTYPE_JOB_TEXT), new_chartypeoption(CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT, CHARTYPE_JOB_TEXT), new_chartypeoption(CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WOMAN, CHARTYPE_JOB), new_chartypeoption(CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_MAN, CHARTYPE_JOB), new_chartypeoption(CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_UNGENDERED_ADULT, CHARTYPE_JOB), new_chartypeoption(CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_ADULT, CHARTYPE_JOB), new_chartypeoption(CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT, CHARTYPE_JOB), new_chartypeoption(CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_JOB_PERSON_TEXT, CHARTYPE_VS16), new_chartypeoption(CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT));
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_UNGENDERED_ADULT, CHARTYPE_CHRISTMAS_TREE), new_chartypeoption(CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT, CHARTYPE_CHRISTMAS_TREE), new_chartypeoption(CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT));
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_PERSON, CHARTYPE_FITZPATRICK), new_chartypeoption(CHARTYPE_FITZPATRICKED_PERSON, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_GENDERABLE_PERSON, CHARTYPE_FITZPATRICK), new_chartypeoption(CHARTYPE_FITZPATRICKED_GENDERABLE_PERSON, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WOMAN, CHARTYPE_FITZPATRICK), new_chartypeoption(CHARTYPE_FITZPATRICKED_ADULT, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_MAN, CHARTYPE_FITZPATRICK), new_chartypeoption(CHARTYPE_FITZPATRICKED_ADULT, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_UNGENDERED_ADULT, CHARTYPE_FITZPATRICK), new_chartypeoption(CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_CHILD, CHARTYPE_FITZPATRICK), new_chartypeoption(CHARTYPE_FITZPATRICKED_PERSON, END_SEQUENCE_WEIGHT));
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_UNGENDERED_ADULT, CHARTYPE_HAIRSTYLE), new_chartypeoption(CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WOMAN, CHARTYPE_HAIRSTYLE), new_chartypeoption(CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_MAN, CHARTYPE_HAIRSTYLE), new_chartypeoption(CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_UNGENDERED_ADULT, CHARTYPE_HAIRSTYLE), new_chartypeoption(CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_ADULT, CHARTYPE_HAIRSTYLE), new_chartypeoption(CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT, CHARTYPE_HAIRSTYLE), new_chartypeoption(CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT));
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_UNGENDERED_ADULT, CHARTYPE_GENDER_TEXT), new_chartypeoption(CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_UNTONED_GENDERABLE_PERSON, CHARTYPE_GENDER_TEXT), new_chartypeoption(CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT, CHARTYPE_GENDER_TEXT), new_chartypeoption(CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_GENDERABLE_PERSON, CHARTYPE_GENDER_TEXT), new_chartypeoption(CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_FITZPATRICKED_GENDERABLE_PERSON, CHARTYPE_GENDER_TEXT), new_chartypeoption(CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_GENDERED_PERSON_TEXT, CHARTYPE_VS16), new_chartypeoption(CHARTYPE_GENDERED_PERSON, END_SEQUENCE_WEIGHT));
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_GENDER_TEXT, CHARTYPE_VS16), new_chartypeoption(CHARTYPE_GENDER, END_SEQUENCE_WEIGHT));
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WHITE_FLAG, CHARTYPE_VS16), new_chartypeoption(CHARTYPE_WHITE_FLAG_VS16, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WHITE_FLAG, CHARTYPE_RAINBOW), new_chartypeoption(CHARTYPE_COMBINED_FLAG, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WHITE_FLAG_VS16, CHARTYPE_RAINBOW), new_chartypeoption(CHARTYPE_COMBINED_FLAG, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WHITE_FLAG, CHARTYPE_TRANSGENDER_SYMBOL), new_chartypeoption(CHARTYPE_PARTIAL_COMBINED_FLAG, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WHITE_FLAG_VS16, CHARTYPE_TRANSGENDER_SYMBOL), new_chartypeoption(CHARTYPE_PARTIAL_COMBINED_FLAG, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_BLACK_FLAG, CHARTYPE_SKULL_AND_CROSSBONES), new_chartypeoption(CHARTYPE_PARTIAL_COMBINED_FLAG, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_PARTIAL_COMBINED_FLAG, CHARTYPE_VS16), new_chartypeoption(CHARTYPE_COMBINED_FLAG, END_SEQUENCE_WEIGHT));
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_WOMAN, CHARTYPE_HEART), new_chartypeoption(CHARTYPE_LOVE_BASE_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_MAN, CHARTYPE_HEART), new_chartypeoption(CHARTYPE_LOVE_BASE_TEXT_POSSIBLE, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_LOVE_BASE_TEXT, CHARTYPE_VS16), new_chartypeoption(CHARTYPE_LOVE_BASE, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_LOVE_BASE_TEXT_POSSIBLE, CHARTYPE_VS16), new_chartypeoption(CHARTYPE_LOVE_BASE_POSSIBLE, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_LOVE_BASE, CHARTYPE_MAN), new_chartypeoption(CHARTYPE_LOVE, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_LOVE_BASE, CHARTYPE_WOMAN), new_chartypeoption(CHARTYPE_LOVE, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_LOVE_BASE_POSSIBLE, CHARTYPE_MAN), new_chartypeoption(CHARTYPE_LOVE, END_SEQUENCE_WEIGHT));
-  // But not Man Heart Woman
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_LOVE_BASE, CHARTYPE_KISS_MARK), new_chartypeoption(CHARTYPE_KISSING_BASE, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_LOVE_BASE_POSSIBLE, CHARTYPE_KISS_MARK), new_chartypeoption(CHARTYPE_KISSING_BASE_POSSIBLE, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_KISSING_BASE, CHARTYPE_MAN), new_chartypeoption(CHARTYPE_KISSING, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_KISSING_BASE, CHARTYPE_WOMAN), new_chartypeoption(CHARTYPE_KISSING, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_KISSING_BASE_POSSIBLE, CHARTYPE_MAN), new_chartypeoption(CHARTYPE_KISSING, END_SEQUENCE_WEIGHT));
-  // But not Man Heart Kiss Woman
-
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_BEAR, CHARTYPE_SNOWFLAKE), new_chartypeoption(CHARTYPE_ZWJ_ANIMAL_TEXT, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_ZWJ_ANIMAL_TEXT, CHARTYPE_VS16), new_chartypeoption(CHARTYPE_ZWJ_ANIMAL, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_DOG, CHARTYPE_SAFETY_VEST), new_chartypeoption(CHARTYPE_ZWJ_ANIMAL, END_SEQUENCE_WEIGHT));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_CAT, CHARTYPE_COLOUR_BLACK), new_chartypeoption(CHARTYPE_ZWJ_ANIMAL, END_SEQUENCE_WEIGHT));
-
-  // We assume that CHARTYPE_TAG strings are valid because it's too much trouble if they're not.
-  // There's a near-zero probability of people writing them by hand, so we should be safe.
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_BLACK_FLAG, CHARTYPE_TAG), new_chartypeoption(CHARTYPE_TAGGED_FLAG, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_TAGGED_FLAG, CHARTYPE_TAG), new_chartypeoption(CHARTYPE_TAGGED_FLAG, WEIGHTED_VALUE));
-  g_hash_table_insert(chartype_map, MAKE_KEY(CHARTYPE_TAGGED_FLAG, CHARTYPE_TAG_CLOSE), new_chartypeoption(CHARTYPE_TAGGED_FLAG, END_SEQUENCE_WEIGHT));
-
-  return chartype_map;
-}
+#define NO_TLD G_MAXUINT
+#define COUNT_WINDOW_SIZE 256
+// A link needs at least a one character host, a dot and a two letter TLD
+#define MIN_LINK_LENGTH_IN_BYTES 4
 
-static gboolean
-is_valid_regional_indicator (gunichar ri_char1, gunichar ri_char2) {
-  if (!ri_validator_generated) {
-    // Strings taken from https://en.wikipedia.org/wiki/Regional_indicator_symbol
-    // Note: We need the trailing space to align everything for the loop!
-    gchar *indicators = "AC AD AE AF AG AI AL AM AO AQ AR AS AT AU AW AX AZ BA BB BD BE BF BG BH BI BJ BL BM BN BO BQ BR BS BT BV BW BY BZ"
-                        " CA CC CD CF CG CH CI CK CL CM CN CO CP CR CU CV CW CX CY CZ DE DG DJ DK DM DO DZ EA EC EE EG EH ER ES ET EU FI FJ FK FM FO FR"
-                        " GA GB GD GE GF GG GH GI GL GM GN GP GQ GR GS GT GU GW GY HK HM HN HR HT HU IC ID IE IL IM IN IO IQ IR IS IT JE JM JO JP"
-                        " KE KG KH KI KM KN KP KR KW KY KZ LA LB LC LI LK LR LS LT LU LV LY MA MC MD ME MF MG MH MK ML MM MN MO MP MQ MR MS MT MU MV MW MX MY MZ"
-                        " NA NC NE NF NG NI NL NO NP NR NU NZ OM PA PE PF PG PH PK PL PM PN PR PS PT PW PY QA RE RO RS RU RW"
-                        " SA SB SC SD SE SG SH SI SJ SK SL SM SN SO SR SS ST SV SX SY SZ TA TC TD TF TG TH TJ TK TL TM TN TO TR TT TV TW TZ"
-                        " UA UG UM UN US UY UZ VA VC VE VG VI VN VU WF WS XK YE YT ZA ZM ZW"
-                        " AN BU CS DD FX NT QU SU TP YD YU ZR ";
-    gchar *char1 = indicators;
-    gchar *char2 = char1 + 1;
+/*
+ * Precomputed facts about the dotted host run (TEXT, NUMBER, DOT and DASH tokens)
+ * starting at a given token, so parse_link() does not have to re-scan the run
+ * from every token it is tried at.
+ */
+typedef struct {
+  // Index of the last TOK_DOT in the run that is followed by a TLD, or NO_TLD
+  guint tld_dot_index;
+  // Length of the host fragment (up to the next dot) starting at this token, capped at 64
+  guint8 fragment_length;
+  // Whether any fragment in the run from this token on is longer than 63 characters
+  gboolean fragment_too_long;
+} HostInfo;
 
-    do {
-      valid_ri_strings[((*char1 - 0x41) * 26) + (*char2 - 0x41)] = TRUE;
-      char1 += 3;
-      char2 += 3;
-    } while (*char1 != '\0');
+/*
+ * Scratch memory that is kept between calls. The arrays are only created once
+ * they are needed and never shrink, so once a context has seen its largest
+ * input, calls with it don't allocate anymore.
+ */
+struct _TlContext {
+  Tokens tokens;
+  GArray *hosts;
+  GArray *entities;
+};
 
-    ri_validator_generated = TRUE;
+/*
+ * context_array:
+ * @array: One of the arrays of a #TlContext
+ * @element_size: Size of the elements of @array
+ *
+ * Returns: (transfer none): @array, created if needed and emptied
+ */
+static inline GArray *
+context_array (GArray **array,
+               guint    element_size)
+{
+  if (*array == NULL) {
+    *array = g_array_new (FALSE, FALSE, element_size);
+  } else {
+    g_array_set_size (*array, 0);
   }
 
-  return valid_ri_strings[((ri_char1 - REGIONAL_INDICATOR_OFFSET) * 26) + (ri_char2 - REGIONAL_INDICATOR_OFFSET)];
+  return *array;
 }
 
-static inline guint
-token_type_from_char (gunichar c)
+/*
+ * tokens_reserve:
+ * @tokens: Tokens living in a #TlContext
+ * @n_tokens: The number of tokens @tokens has to have room for
+ */
+static void
+tokens_reserve (Tokens *tokens,
+                gsize   n_tokens)
 {
-  switch (c) {
-    case '@':
-      return TOK_AT;
-    case '#':
-      return TOK_HASH;
-    case ':':
-      return TOK_COLON;
-    case '/':
-      return TOK_SLASH;
-    case '(':
-      return TOK_OPEN_PAREN;
-    case ')':
-      return TOK_CLOSE_PAREN;
-    case '.':
-      return TOK_DOT;
-    case '?':
-      return TOK_QUESTIONMARK;
-    case '=':
-      return TOK_EQUALS;
-    case '-':
-      return TOK_DASH;
-    case '_':
-      return TOK_UNDERSCORE;
-    case '\'':
-      return TOK_APOSTROPHE;
-    case '"':
-      return TOK_QUOTE;
-    case '$':
-      return TOK_DOLLAR;
-    case '&':
-      return TOK_AMPERSAND;
-    case '!':
-      return TOK_EXCLAMATION;
-    case '~':
-      return TOK_TILDE;
-    case '0':
-    case '1':
-    case '2':
-    case '3':
-    case '4':
-    case '5':
-    case '6':
-    case '7':
-    case '8':
-    case '9':
-      return TOK_NUMBER;
-    case ' ':
-    case '\n':
-    case '\t':
-      return TOK_WHITESPACE;
-
-    default:
-      return TOK_TEXT;
+  if (n_tokens + 1 <= tokens->allocated) {
+    return;
   }
+
+  tokens->allocated = MAX (n_tokens + 1, tokens->allocated * 2);
+  tokens->byte_offsets = g_renew (guint32, tokens->byte_offsets, tokens->allocated);
+  tokens->character_offsets = g_renew (guint32, tokens->character_offsets, tokens->allocated);
+  tokens->utf16_offsets = g_renew (guint32, tokens->utf16_offsets, tokens->allocated);
+  tokens->weighted_offsets = g_renew (guint32, tokens->weighted_offsets, tokens->allocated);
+  tokens->plain_weighted_offsets = g_renew (guint32, tokens->plain_weighted_offsets, tokens->allocated);
+  tokens->types = g_renew (guint8, tokens->types, tokens->allocated);
+  tokens->classes = g_renew (guint16, tokens->classes, tokens->allocated);
 }
 
-static inline gboolean
-token_ends_in_accented (const Token *t)
+static void
+context_clear (TlContext *context)
 {
-  const char *p = t->start;
-  gunichar c;
-  gsize i;
-
-  if (t->length_in_bytes == 1 ||
-      t->type != TOK_TEXT) {
-    return FALSE;
+  g_free (context->tokens.byte_offsets);
+  g_free (context->tokens.character_offsets);
+  g_free (context->tokens.utf16_offsets);
+  g_free (context->tokens.weighted_offsets);
+  g_free (context->tokens.plain_weighted_offsets);
+  g_free (context->tokens.types);
+  g_free (context->tokens.classes);
+  memset (&context->tokens, 0, sizeof (Tokens));
+
+  if (context->hosts != NULL) {
+    g_array_free (context->hosts, TRUE);
   }
-
-  // The rules here aren't exactly clear...
-  // We read the last character of the text pointed to by the given token.
-  // If that's not an ascii character, we return TRUE.
-  for (i = 0; i < t->length_in_characters - 1; i ++) {
-    p = g_utf8_next_char (p);
+  if (context->entities != NULL) {
+    g_array_free (context->entities, TRUE);
   }
 
-  c = g_utf8_get_char (p);
-
-  if (c > 127)
-    return TRUE;
+  context->hosts = NULL;
+  context->entities = NULL;
+}
 
-  return FALSE;
+#ifdef LIBTL_DEBUG
+static char * G_GNUC_UNUSED
+token_str (const Tokens *tokens,
+           gsize         i)
+{
+  return g_strdup_printf ("Type: %u, Text: '%.*s'", tokens->types[i],
+                          (int)token_length_in_bytes (tokens, i), token_start (tokens, i));
 }
 
-static inline gboolean
-token_in (const Token *t,
-          const char  *haystack)
+static char * G_GNUC_UNUSED
+entity_str (const TlEntity *e)
 {
-  const int haystack_len = strlen (haystack);
-  int i;
+  return g_strdup_printf ("Type: %u, Text: '%.*s'", e->type, (int)e->length_in_bytes, e->start);
+}
 
-  if (t->length_in_bytes > 1) {
-    return FALSE;
-  }
+#endif
 
+typedef struct _CharTypeOption {
+  guint8 new_chartype;
+  guint8 carry_weight;
+} CharTypeOption;
 
-  for (i = 0; i < haystack_len; i ++) {
-    if (haystack[i] == t->start[0]) {
-      return TRUE;
-    }
-  }
+// Replacement character type (and the weight it carries) for the current character type,
+// indexed by the previous character type and then the current one. Pairs without a rule
+// are left as CHARTYPE_NONE.
+static const CharTypeOption chartype_options[N_CHARTYPES][N_CHARTYPES] = {
+  [CHARTYPE_WOMAN] = {
+    [CHARTYPE_WOMAN] = { CHARTYPE_FAMILY_PARENTS, WEIGHTED_VALUE },
+    // But not Woman then Man for the family
+    [CHARTYPE_CHILD] = { CHARTYPE_FAMILY_1_CHILD, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_JOB_TEXT] = { CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE },
+    [CHARTYPE_JOB] = { CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_FITZPATRICK] = { CHARTYPE_FITZPATRICKED_ADULT, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_HAIRSTYLE] = { CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_HEART] = { CHARTYPE_LOVE_BASE_TEXT, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_MAN] = {
+    [CHARTYPE_MAN] = { CHARTYPE_FAMILY_PARENTS, WEIGHTED_VALUE },
+    [CHARTYPE_WOMAN] = { CHARTYPE_FAMILY_PARENTS, WEIGHTED_VALUE },
+    [CHARTYPE_CHILD] = { CHARTYPE_FAMILY_1_CHILD, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_JOB_TEXT] = { CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE },
+    [CHARTYPE_JOB] = { CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_FITZPATRICK] = { CHARTYPE_FITZPATRICKED_ADULT, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_HAIRSTYLE] = { CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_HEART] = { CHARTYPE_LOVE_BASE_TEXT_POSSIBLE, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_FAMILY_PARENTS] = {
+    [CHARTYPE_CHILD] = { CHARTYPE_FAMILY_1_CHILD, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_FAMILY_1_CHILD] = {
+    [CHARTYPE_CHILD] = { CHARTYPE_FAMILY_2_CHILD, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_UNGENDERED_ADULT] = {
+    [CHARTYPE_JOB_TEXT] = { CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE },
+    [CHARTYPE_JOB] = { CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_CHRISTMAS_TREE] = { CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_FITZPATRICK] = { CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_HAIRSTYLE] = { CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_GENDER_TEXT] = { CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_FITZPATRICKED_ADULT] = {
+    [CHARTYPE_JOB_TEXT] = { CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE },
+    [CHARTYPE_JOB] = { CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_HAIRSTYLE] = { CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_FITZPATRICKED_UNGENDERED_ADULT] = {
+    [CHARTYPE_JOB_TEXT] = { CHARTYPE_JOB_PERSON_TEXT, WEIGHTED_VALUE },
+    [CHARTYPE_JOB] = { CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_CHRISTMAS_TREE] = { CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_HAIRSTYLE] = { CHARTYPE_HAIRSTYLED_ADULT, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_GENDER_TEXT] = { CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_JOB_PERSON_TEXT] = {
+    [CHARTYPE_VS16] = { CHARTYPE_JOB_PERSON, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_PERSON] = {
+    [CHARTYPE_FITZPATRICK] = { CHARTYPE_FITZPATRICKED_PERSON, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_GENDERABLE_PERSON] = {
+    [CHARTYPE_FITZPATRICK] = { CHARTYPE_FITZPATRICKED_GENDERABLE_PERSON, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_GENDER_TEXT] = { CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_CHILD] = {
+    [CHARTYPE_FITZPATRICK] = { CHARTYPE_FITZPATRICKED_PERSON, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_UNTONED_GENDERABLE_PERSON] = {
+    [CHARTYPE_GENDER_TEXT] = { CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_FITZPATRICKED_GENDERABLE_PERSON] = {
+    [CHARTYPE_GENDER_TEXT] = { CHARTYPE_GENDERED_PERSON_TEXT, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_GENDERED_PERSON_TEXT] = {
+    [CHARTYPE_VS16] = { CHARTYPE_GENDERED_PERSON, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_GENDER_TEXT] = {
+    [CHARTYPE_VS16] = { CHARTYPE_GENDER, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_WHITE_FLAG] = {
+    [CHARTYPE_VS16] = { CHARTYPE_WHITE_FLAG_VS16, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_RAINBOW] = { CHARTYPE_COMBINED_FLAG, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_TRANSGENDER_SYMBOL] = { CHARTYPE_PARTIAL_COMBINED_FLAG, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_WHITE_FLAG_VS16] = {
+    [CHARTYPE_RAINBOW] = { CHARTYPE_COMBINED_FLAG, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_TRANSGENDER_SYMBOL] = { CHARTYPE_PARTIAL_COMBINED_FLAG, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_BLACK_FLAG] = {
+    [CHARTYPE_SKULL_AND_CROSSBONES] = { CHARTYPE_PARTIAL_COMBINED_FLAG, WEIGHTED_VALUE },
+    // We assume that CHARTYPE_TAG strings are valid because it's too much trouble if they're not.
+    // There's a near-zero probability of people writing them by hand, so we should be safe.
+    [CHARTYPE_TAG] = { CHARTYPE_TAGGED_FLAG, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_PARTIAL_COMBINED_FLAG] = {
+    [CHARTYPE_VS16] = { CHARTYPE_COMBINED_FLAG, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_LOVE_BASE_TEXT] = {
+    [CHARTYPE_VS16] = { CHARTYPE_LOVE_BASE, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_LOVE_BASE_TEXT_POSSIBLE] = {
+    [CHARTYPE_VS16] = { CHARTYPE_LOVE_BASE_POSSIBLE, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_LOVE_BASE] = {
+    [CHARTYPE_MAN] = { CHARTYPE_LOVE, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_WOMAN] = { CHARTYPE_LOVE, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_KISS_MARK] = { CHARTYPE_KISSING_BASE, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_LOVE_BASE_POSSIBLE] = {
+    [CHARTYPE_MAN] = { CHARTYPE_LOVE, END_SEQUENCE_WEIGHT },
+    // But not Man Heart Woman
+    [CHARTYPE_KISS_MARK] = { CHARTYPE_KISSING_BASE_POSSIBLE, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_KISSING_BASE] = {
+    [CHARTYPE_MAN] = { CHARTYPE_KISSING, END_SEQUENCE_WEIGHT },
+    [CHARTYPE_WOMAN] = { CHARTYPE_KISSING, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_KISSING_BASE_POSSIBLE] = {
+    [CHARTYPE_MAN] = { CHARTYPE_KISSING, END_SEQUENCE_WEIGHT },
+    // But not Man Heart Kiss Woman
+  },
+  [CHARTYPE_BEAR] = {
+    [CHARTYPE_SNOWFLAKE] = { CHARTYPE_ZWJ_ANIMAL_TEXT, WEIGHTED_VALUE },
+  },
+  [CHARTYPE_ZWJ_ANIMAL_TEXT] = {
+    [CHARTYPE_VS16] = { CHARTYPE_ZWJ_ANIMAL, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_DOG] = {
+    [CHARTYPE_SAFETY_VEST] = { CHARTYPE_ZWJ_ANIMAL, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_CAT] = {
+    [CHARTYPE_COLOUR_BLACK] = { CHARTYPE_ZWJ_ANIMAL, END_SEQUENCE_WEIGHT },
+  },
+  [CHARTYPE_TAGGED_FLAG] = {
+    [CHARTYPE_TAG] = { CHARTYPE_TAGGED_FLAG, WEIGHTED_VALUE },
+    [CHARTYPE_TAG_CLOSE] = { CHARTYPE_TAGGED_FLAG, END_SEQUENCE_WEIGHT },
+  },
+};
 
-  return FALSE;
+static gboolean
+is_valid_regional_indicator (gunichar ri_char1, gunichar ri_char2) {
+  return (valid_ri_pairs[ri_char1 - REGIONAL_INDICATOR_OFFSET] >> (ri_char2 - REGIONAL_INDICATOR_OFFSET)) & 1;
 }
 
-
-static inline void
-emplace_token (GArray     *array,
-               const char *token_start,
-               gsize       token_length,
-               gsize       start_character_index,
-               gsize       length_in_characters,
-               gsize       length_in_weighted_characters)
+static inline guint
+char_properties (gunichar c)
 {
-  Token *t;
-
-  g_array_set_size (array, array->len + 1);
-  t = &g_array_index (array, Token, array->len - 1);
+  if (G_UNLIKELY (c > 0x10FFFF)) {
+    return CHAR_PROPS_INVALID;
+  }
 
-  t->type = token_type_from_char (token_start[0]);
-  t->start = token_start;
-  t->length_in_bytes = token_length;
-  t->start_character_index = start_character_index;
-  t->length_in_characters = length_in_characters;
-  t->length_in_weighted_characters = length_in_weighted_characters;
+  return CHAR_PROPS[CHAR_PROPS_BLOCKS[c >> CHAR_PROPS_BLOCK_SHIFT]][c & CHAR_PROPS_BLOCK_MASK];
 }
 
-static inline void
-emplace_entity_for_tokens (GArray      *array,
-                           const Token *tokens,
-                           guint        entity_type,
-                           guint        start_token_index,
-                           guint        end_token_index)
+static inline guint
+token_type_from_char (gunichar c)
 {
-  TlEntity *e;
-  guint i;
-
-  g_array_set_size (array, array->len + 1);
-  e = &g_array_index (array, TlEntity, array->len - 1);
-
-  e->type = entity_type;
-  e->start = tokens[start_token_index].start;
-  e->length_in_bytes = 0;
-  e->length_in_characters = 0;
-  e->length_in_weighted_characters = 0;
-  e->start_character_index = tokens[start_token_index].start_character_index;
+  return CHAR_PROPS_TOKEN_TYPE (char_properties (c));
+}
 
-  for (i = start_token_index; i <= end_token_index; i ++) {
-    e->length_in_bytes += tokens[i].length_in_bytes;
-    e->length_in_characters += tokens[i].length_in_characters;
-    e->length_in_weighted_characters += tokens[i].length_in_weighted_characters;
-  }
+static inline gboolean
+token_ends_in_accented (const Tokens *tokens,
+                        gsize         token_index)
+{
+  // The rules here aren't exactly clear...
+  // The tokenizer has looked at the last character of the token already.
+  return (tokens->classes[token_index] & TC_ENDS_IN_ACCENTED) != 0;
 }
 
 static inline gboolean
-is_valid_mention_char (gunichar c)
+token_in (const Tokens *tokens,
+          gsize         token_index,
+          guint         token_class)
 {
-  // Just ASCII
-  if (c > 127)
-    return FALSE;
+  return (tokens->classes[token_index] & token_class) != 0;
+}
 
-  return TRUE;
+
+static inline void
+entity_for_tokens (TlEntity     *e,
+                   const Tokens *tokens,
+                   guint         entity_type,
+                   guint         start_token_index,
+                   guint         end_token_index)
+{
+  const guint end = end_token_index + 1;
+
+  e->type = entity_type;
+  e->start = token_start (tokens, start_token_index);
+  e->length_in_bytes = tokens->byte_offsets[end] - tokens->byte_offsets[start_token_index];
+  e->length_in_characters = tokens->character_offsets[end] - tokens->character_offsets[start_token_index];
+  e->length_in_weighted_characters = (guint32)(tokens->weighted_offsets[end] -
+                                               tokens->weighted_offsets[start_token_index]);
+  e->start_character_index = token_start_character_index (tokens, start_token_index);
+  e->start_utf16_index = token_start_utf16_index (tokens, start_token_index);
+  e->length_in_utf16_units = tokens->utf16_offsets[end] - tokens->utf16_offsets[start_token_index];
 }
 
 
 static inline gboolean
-token_is_tld (const Token *t,
-              gboolean     has_protocol)
+token_is_tld (const Tokens *tokens,
+              gsize         token_index)
 {
-  guint i;
+  const char *start = token_start (tokens, token_index);
+  const gsize length_in_bytes = token_length_in_bytes (tokens, token_index);
+  char folded[TLD_MAX_LENGTH];
+  gsize lower, upper;
+  gsize i;
 
-  if (t->length_in_characters > GTLDS[G_N_ELEMENTS (GTLDS) - 1].length) {
+  if (length_in_bytes > TLD_MAX_LENGTH) {
     return FALSE;
   }
 
-  for (i = 0; i < G_N_ELEMENTS (GTLDS); i ++) {
-    if (t->length_in_characters == GTLDS[i].length &&
-        strncasecmp (t->start, GTLDS[i].str, t->length_in_bytes) == 0) {
-      return TRUE;
-    }
+  // All TLDs are lower case, so fold the token once and compare bytes from then on
+  for (i = 0; i < length_in_bytes; i ++) {
+    folded[i] = g_ascii_tolower (start[i]);
   }
 
-  for (i = 0; i < G_N_ELEMENTS (CCTLDS); i ++) {
-    if (t->length_in_characters == CCTLDS[i].length &&
-        strncasecmp (t->start, CCTLDS[i].str, t->length_in_bytes) == 0) {
+  lower = TLD_OFFSETS[length_in_bytes];
+  upper = TLD_OFFSETS[length_in_bytes + 1];
+
+  while (lower < upper) {
+    const gsize middle = lower + (upper - lower) / 2;
+    const int cmp = memcmp (folded, TLDS[middle], length_in_bytes);
+
+    if (cmp == 0) {
       return TRUE;
+    } else if (cmp < 0) {
+      upper = middle;
+    } else {
+      lower = middle + 1;
     }
   }
 
@@ -475,64 +535,21 @@ token_is_tld (const Token *t,
 }
 
 static inline gboolean
-token_is_protocol (const Token *t)
+token_is_protocol (const Tokens *tokens,
+                   gsize         token_index)
 {
-  if (t->type != TOK_TEXT) {
-    return FALSE;
-  }
+  const gsize length_in_bytes = token_length_in_bytes (tokens, token_index);
 
-  if (t->length_in_bytes != 4 && t->length_in_bytes != 5) {
+  if (tokens->types[token_index] != TOK_TEXT) {
     return FALSE;
   }
 
-  return strncasecmp (t->start, "http", t->length_in_bytes) == 0 ||
-         strncasecmp (t->start, "https", t->length_in_bytes) == 0;
-}
-
-static inline gboolean
-char_splits (gunichar c)
-{
-  switch (c) {
-    case ',':
-    case '.':
-    case '/':
-    case '?':
-    case '(':
-    case ')':
-    case ':':
-    case ';':
-    case '=':
-    case '@':
-    case '#':
-    case '-':
-    case '_':
-    case '\n':
-    case '\t':
-    case '\0':
-    case ' ':
-    case '\'':
-    case '"':
-    case '$':
-    case '|':
-    case '&':
-    case '^':
-    case '%':
-    case '+':
-    case '*':
-    case '\\':
-    case '{':
-    case '}':
-    case '[':
-    case ']':
-    case '`':
-    case '~':
-    case '!':
-      return TRUE;
-    default:
-      return FALSE;
+  if (length_in_bytes != 4 && length_in_bytes != 5) {
+    return FALSE;
   }
 
-  return FALSE;
+  return strncasecmp (token_start (tokens, token_index), "http", length_in_bytes) == 0 ||
+         strncasecmp (token_start (tokens, token_index), "https", length_in_bytes) == 0;
 }
 
 static inline gsize
@@ -549,521 +566,1036 @@ entity_length_in_characters (const TlEntity *e)
 
 static inline gboolean
 is_weighted_character (gunichar ch) {
-  // Based on https://developer.twitter.com/en/docs/developer-utilities/twitter-text
-  // then the following ranges count as "1", everything else is "2":
-  //   * 0 - 4351 (0x0 - 0x10FF) = Latin through to Georgian
-  //   * 8192 - 8205 (0x2000 - 0x200D) = Unicode spaces
-  //   * 8208 - 8223 (0x2010 - 0x201F) = Unicode hyphens and smart quotes
-  //   * 8242 - 8247 (0x2032 - 0x2037) = Prime marks
-  return !((ch >= 0    && ch <= 4351) ||
-           (ch >= 8192 && ch <= 8205) ||
-           (ch >= 8208 && ch <= 8223) ||
-           (ch >= 8242 && ch <= 8247));
+  // See chartypes.in for which characters count as "1" and which count as "2"
+  return (char_properties (ch) & CHAR_PROPS_WEIGHTED) != 0;
 }
 
 static inline guint
-chartype_for_char (gunichar c)
-{
-  if (c == 0x200D) {
-    return CHARTYPE_ZWJ;
-  }
-  else if (!is_weighted_character (c)) {
-    return CHARTYPE_UNWEIGHTED;
-  }
-  else if (c == 0xFE0F) {
-    return CHARTYPE_VS16;
-  }
-  else if ((c >= 0x1100 && c < 0x2000) || (c >= 0x2800 && c <= 0x1F1E5 && c != 0x2B1B)) {
-    // Hangul Jamo through Greek Extended
-    // and Braille Patterns through Enclosed Alphanumeric Supplemental (that aren't Regional Indicators)
-    // We specifically exclude U+2B1B to keep the range as big as possible
-    return CHARTYPE_WEIGHTED_OTHER;
-  }
-  else if (c >= 0x1F3FB && c <= 0x1F3FF) {
-    return CHARTYPE_FITZPATRICK;
-  }
-  else if (c == 0x1f466 || c == 0x1f467) {
-    return CHARTYPE_CHILD;
-  }
-  else if (c == 0x1F468) {
-    return CHARTYPE_MAN;
-  }
-  else if (c == 0x1F469) {
-    return CHARTYPE_WOMAN;
-  }
-  else if (c == 0x1F9D1) {
-    return CHARTYPE_UNGENDERED_ADULT;
-  }
-  else if (c == 0x26F9
-           || c == 0x1F3C3
-           || c == 0x1F3C4
-           || (c >= 0x1F3CA && c == 0x1F3CC)
-           || c == 0x1F46E
-           || c == 0x1F470
-           || c == 0x1F471
-           || c == 0x1F473
-           || c == 0x1F477
-           || c == 0x1F481
-           || c == 0x1F482
-           || c == 0x1F486
-           || c == 0x1F487
-           || c == 0x1F575
-           || (c >= 0x1F645 && c<= 0x1F647)
-           || c == 0x1F64B
-           || c == 0x1F64D
-           || c == 0x1F64E
-           || c == 0x1F6A3
-           || (c >= 0x1F6B4 && c <= 0x1F6B6)
-           || c == 0x1F926
-           || c == 0x1F935
-           || (c >= 0x1F937 && c <= 0x1F939)
-           || c == 0x1F93D
-           || c == 0x1F93E
-           || c == 0x1F9B8
-           || c == 0x1F9B9
-           || (c >= 0x1F9CD && c <= 0x1F9CF)
-           || (c >= 0x1F9D6 && c <= 0x1F9DE)
-           ) {
-    return CHARTYPE_GENDERABLE_PERSON;
-  }
-  else if (c == 0x1F46F || c == 0x1F93C || c == 0x1F9DD) {
-    // Zombies, wrestlers and bunnie people, oh my!
-    return CHARTYPE_UNTONED_GENDERABLE_PERSON;
-  }
-  else if (c == 0x261D
-           || (c >= 0x270A && c<= 0x270C)
-           || c == 0x270D
-           || c == 0x1F385
-           || c == 0x1F3C2
-           || c == 0x1F3C7
-           || c == 0x1F442
-           || c == 0x1F443
-           || (c >= 0x1F446 && c <= 0x1F450)
-           || (c >= 0x1F466 && c <= 0x1F46D)
-           || c == 0x1F47C
-           || c == 0x1F483
-           || c == 0x1F485
-           || c == 0x1F48F
-           || c == 0x1F491
-           || c == 0x1F4AA
-           || c == 0x1F574
-           || c == 0x1F57A
-           || c == 0x1F590
-           || c == 0x1F595
-           || c == 0x1F596
-           || c == 0x1F64C
-           || c == 0x1F6C0
-           || c == 0x1F6CC
-           || c == 0x1F90C
-           || c == 0x1F90F
-           || c == 0x1F918
-           || (c >= 0x1F919 && c <= 0x1F91E)
-           || c == 0x1F91F
-           || (c >= 0x1F930 && c <= 0x1F934)
-           || c == 0x1F936
-           || c == 0x1F977
-           || c == 0x1F9B5
-           || c == 0x1F9B6
-           || c == 0x1F9BB
-           || (c >= 0x1F9D1 && c<= 0x1F9D5)) {
-    return CHARTYPE_PERSON;
-  }
-  else if (c == 0xE007F) {
-    return CHARTYPE_TAG_CLOSE;
-  }
-  else if (c == 0x1F33E
-           || c == 0x1F373
-           || c == 0x1F37C
-           || c == 0x1F393
-           || c == 0x1F3A4
-           || c == 0x1F3A8
-           || c == 0x1F3EB
-           || c == 0x1F3ED
-           || c == 0x1F4BB
-           || c == 0x1F4BC
-           || c == 0x1F527
-           || c == 0x1F52C
-           || c == 0x1F680
-           || c == 0x1F692
-           || c == 0x1F9AF
-           || c == 0x1F9BC
-           || c == 0x1F9BD
-          ) {
-    return CHARTYPE_JOB;
-  }
-  else if (c == 0x2695 || c == 0x2696 || c == 0x2708) {
-    return CHARTYPE_JOB_TEXT;
-  }
-  else if (c >= 0x1F1E6 && c <= 0x1F1FF) {
-    return CHARTYPE_REGIONAL_INDICATOR;
-  }
-  else if (c == 0x1F3F3) {
-    return CHARTYPE_WHITE_FLAG;
-  }
-  else if (c == 0x1F3F4) {
-    return CHARTYPE_BLACK_FLAG;
-  }
-  else if (c == 0x1F308) {
-    return CHARTYPE_RAINBOW;
-  }
-  else if (c == 0x26A7) {
-    return CHARTYPE_TRANSGENDER_SYMBOL;
-  }
-  else if (c == 0x2620) {
-    return CHARTYPE_SKULL_AND_CROSSBONES;
-  }
-  else if (c == 0x2764) {
-    return CHARTYPE_HEART;
-  }
-  else if (c == 0x1F48B) {
-    return CHARTYPE_KISS_MARK;
-  }
-  else if (c >= 0x1F9B0 && c <= 0x1F9B3) {
-    return CHARTYPE_HAIRSTYLE;
-  }
-  else if (c == 0x2640 || c == 0x2642) {
-    return CHARTYPE_GENDER_TEXT;
-  }
-  else if (c == 0x1F384) {
-    return CHARTYPE_CHRISTMAS_TREE;
-  }
-  else if (c == 0x1F408) {
-    return CHARTYPE_CAT;
-  }
-  else if (c == 0x1F415) {
-    return CHARTYPE_DOG;
-  }
-  else if (c == 0x1F43B) {
-    return CHARTYPE_BEAR;
-  }
-  else if (c == 0x1F9BA) {
-    return CHARTYPE_SAFETY_VEST;
-  }
-  else if (c == 0x2B1B) {
-    return CHARTYPE_COLOUR_BLACK;
-  }
-  else if (c == 0x2744) {
-    return CHARTYPE_SNOWFLAKE;
-  }
-  else if ((c >= 0xE0030 && c <= 0xE0039)
-            || (c >= 0xE0041 && c <= 0xE005A)
-            || (c >= 0xE0061 && c <= 0xE007A)) {
-    // Capital letters and digits, as per https://www.unicode.org/L2/L2015/15190-pri299-additional-flags-bkgnd.html
-    // But Twitter takes lower-case
-    return CHARTYPE_TAG;
-  }
-  else {
-#ifdef LIBTL_DEBUG
-    g_debug("Fell through to \"other\" for 0x%08X", c);
-#endif
-    return CHARTYPE_WEIGHTED_OTHER;
-  }
+char_weight (guint props)
+{
+  return (props & CHAR_PROPS_WEIGHTED) ? WEIGHTED_VALUE : UNWEIGHTED_VALUE;
 }
 
 /*
- * tokenize:
+ * State of the compact emoji matching within a token
+ */
+typedef struct {
+  guint prev_char_type;
+  // Weight of the partially built sequence, which is only added once we know it didn't complete
+  guint carry_weight;
+  gboolean is_zwjed;
+  gunichar prev_ri_char;
+} EmojiSequence;
+
+/*
+ * emoji_sequence_next:
+ * @sequence: The sequence so far
+ * @cur_char: The next character
+ * @cur_props: char_properties() of @cur_char
+ * @weight: (inout): Weighted length to add the finished characters to
  *
- * Returns: (transfer full): Tokens
+ * Returns: %TRUE if @cur_char continues the sequence, %FALSE if it starts a new one
  */
-static GArray *
-tokenize (const char *input,
-          gsize       length_in_bytes,
-          gboolean    compact_emoji)
+static inline gboolean
+emoji_sequence_next (EmojiSequence *sequence,
+                     gunichar       cur_char,
+                     guint          cur_props,
+                     gsize         *weight)
 {
-  GArray *tokens = g_array_new (FALSE, TRUE, sizeof (Token));
-  const char *p = input;
-  gsize cur_character_index = 0;
-  GHashTable *chartype_map = get_chartype_options();
-
-  while (p - input < (long)length_in_bytes) {
-    const char *cur_start = p;
-    gunichar cur_char = g_utf8_get_char (p);
-    gsize cur_length = 0;
-    gsize length_in_chars = 0;
-    gsize length_in_weighted_chars = 0;
-    guint last_token_type = 0;
-    guint prev_char_type = CHARTYPE_NONE;
-    guint cur_char_type = CHARTYPE_NONE;
-    guint carry_weight = 0;
-    gboolean is_zwjed = FALSE;
-    gboolean matched = FALSE;
-    gunichar prev_ri_char = '\0';
-    CharTypeOption *data;
-
-    /* If this char already splits, it's a one-char token */
-    if (char_splits (cur_char)) {
-      const char *old_p = p;
-      p = g_utf8_next_char (p);
-      emplace_token (tokens, cur_start, p - old_p, cur_character_index, 1, is_weighted_character (cur_char) ? WEIGHTED_VALUE : UNWEIGHTED_VALUE);
-      cur_character_index ++;
-      continue;
+  guint cur_char_type = CHAR_PROPS_CHARTYPE (cur_props);
+  gboolean matched = FALSE;
+  const CharTypeOption *data;
+
+  if (cur_char_type == CHARTYPE_ZWJ) {
+    if (!sequence->is_zwjed) {
+      matched = TRUE;
+      sequence->is_zwjed = TRUE;
+      sequence->carry_weight += UNWEIGHTED_VALUE;
     }
-
-    last_token_type = token_type_from_char (cur_char);
-
-    do {
-      if (compact_emoji) {
-        matched = FALSE;
-        cur_char_type = chartype_for_char (cur_char);
-
-        if (cur_char_type == CHARTYPE_ZWJ) {
-          if (!is_zwjed) {
-            matched = TRUE;
-            is_zwjed = TRUE;
-            carry_weight += UNWEIGHTED_VALUE;
-          }
-          cur_char_type = prev_char_type;
-        }
-        else if (cur_char_type == CHARTYPE_REGIONAL_INDICATOR) {
-          if (prev_char_type == CHARTYPE_REGIONAL_INDICATOR && is_valid_regional_indicator (prev_ri_char, cur_char)) {
-            matched = TRUE;
-            cur_char_type = CHARTYPE_REGIONAL_INDICATOR_FLAG;
-          }
-          prev_ri_char = cur_char;
+    cur_char_type = sequence->prev_char_type;
+  }
+  else if (cur_char_type == CHARTYPE_REGIONAL_INDICATOR) {
+    if (sequence->prev_char_type == CHARTYPE_REGIONAL_INDICATOR &&
+        is_valid_regional_indicator (sequence->prev_ri_char, cur_char)) {
+      matched = TRUE;
+      cur_char_type = CHARTYPE_REGIONAL_INDICATOR_FLAG;
+    }
+    sequence->prev_ri_char = cur_char;
+  }
+  else {
+    if (sequence->is_zwjed || cur_char_type == CHARTYPE_FITZPATRICK || cur_char_type == CHARTYPE_VS16
+        || cur_char_type == CHARTYPE_TAG || sequence->prev_char_type == CHARTYPE_TAGGED_FLAG) {
+      data = &chartype_options[sequence->prev_char_type][cur_char_type];
+
+      if (data->new_chartype != CHARTYPE_NONE) {
+        matched = TRUE;
+        int char_carry_weight = data->carry_weight;
+        cur_char_type = data->new_chartype;
+        if (char_carry_weight == END_SEQUENCE_WEIGHT) {
+          // It was a completing character
+          sequence->carry_weight = 0;
         }
         else {
-          if (is_zwjed || cur_char_type == CHARTYPE_FITZPATRICK || cur_char_type == CHARTYPE_VS16
-              || cur_char_type == CHARTYPE_TAG || prev_char_type == CHARTYPE_TAGGED_FLAG) {
-            data = g_hash_table_lookup(chartype_map, MAKE_KEY(prev_char_type, cur_char_type));
-
-            if (data != NULL) {
-              matched = TRUE;
-              int char_carry_weight = data->carry_weight;
-              cur_char_type = data->new_chartype;
-              if (char_carry_weight == END_SEQUENCE_WEIGHT) {
-                // It was a completing character
-                carry_weight = 0;
-              }
-              else {
-                carry_weight += char_carry_weight;
-              }
-            }
-            // Else it didn't have a mapping
-          }
-
-          is_zwjed = FALSE;
-        }
-
-        if (!matched) {
-          // If we didn't match a rule then any partially built sequence (carry_weight)
-          length_in_weighted_chars += carry_weight + (is_weighted_character (cur_char) ? WEIGHTED_VALUE : UNWEIGHTED_VALUE);
-          carry_weight = 0;
+          sequence->carry_weight += char_carry_weight;
         }
-
-        prev_char_type = cur_char_type;
-      }
-      else {
-        length_in_weighted_chars += is_weighted_character (cur_char) ? WEIGHTED_VALUE : UNWEIGHTED_VALUE;
       }
+      // Else it didn't have a mapping
+    }
 
-      const char *old_p = p;
-      p = g_utf8_next_char (p);
-      cur_char = g_utf8_get_char (p);
-      cur_length += p - old_p;
-      length_in_chars ++;
+    sequence->is_zwjed = FALSE;
+  }
 
-      if (token_type_from_char (cur_char) != last_token_type) {
-        length_in_weighted_chars += carry_weight;
-        carry_weight = 0;
-        break;
-      }
+  if (!matched) {
+    // If we didn't match a rule then any partially built sequence (carry_weight) is finished
+    *weight += sequence->carry_weight + char_weight (cur_props);
+    sequence->carry_weight = 0;
+  }
 
-    } while (!char_splits (cur_char) &&
-             p - input < (long)length_in_bytes);
+  sequence->prev_char_type = cur_char_type;
 
-    length_in_weighted_chars += carry_weight;
-    emplace_token (tokens, cur_start, cur_length, cur_character_index, length_in_chars, length_in_weighted_chars);
+  return matched;
+}
 
-    cur_character_index += length_in_chars;
+/*
+ * text_weight:
+ *
+ * Returns: The weighted length of @text on its own, without links, the way
+ *   the tokenizer counts it
+ */
+static gsize
+text_weight (const char *text,
+             gsize       length_in_bytes,
+             gboolean    compact_emoji)
+{
+  const char *p = text;
+  const char *end = text + length_in_bytes;
+  EmojiSequence sequence = { CHARTYPE_NONE, 0, FALSE, '\0' };
+  gsize compact_weight = 0;
+  gsize weight = 0;
+
+  while (p < end) {
+    const gunichar c = g_utf8_get_char (p);
+    const guint props = char_properties (c);
+
+    emoji_sequence_next (&sequence, c, props, &compact_weight);
+    weight += char_weight (props);
+    p = g_utf8_next_char (p);
   }
 
-  return g_steal_pointer (&tokens);
+  return compact_emoji ? compact_weight + sequence.carry_weight : weight;
 }
 
-static gboolean
-parse_link_tail (GArray      *entities,
-                 const Token *tokens,
-                 gsize        n_tokens,
-                 guint       *current_position)
+/*
+ * utf16_length:
+ *
+ * Returns: The length of @text in UTF-16 code units
+ */
+static gsize
+utf16_length (const char *text,
+              gsize       length_in_bytes)
 {
-  guint i = *current_position;
-  const Token *t;
-
-  gsize paren_level = 0;
-  int first_paren_index = -1;
-  for (;;) {
-    t = &tokens[i];
+  const guchar *p = (const guchar *)text;
+  const guchar *end = p + length_in_bytes;
+  gsize length = 0;
 
-    if (t->type == TOK_WHITESPACE || t->type == TOK_APOSTROPHE) {
-      i --;
-      break;
-    }
+  // Every character takes one code unit, except those of four bytes, which need a surrogate pair
+  for (; p < end; p ++) {
+    length += ((*p & 0xC0) != 0x80) + (*p >= 0xF0);
+  }
 
-    if (tokens[i].type == TOK_OPEN_PAREN) {
+  return length;
+}
 
-      if (first_paren_index == -1) {
-        first_paren_index = i;
-      }
-      paren_level ++;
-      if (paren_level == 3) {
-        break;
-      }
-    } else if (tokens[i].type == TOK_CLOSE_PAREN) {
-      if (first_paren_index == -1) {
-        first_paren_index = i;
+/*
+ * truncate_chars:
+ * @text: The text to cut
+ * @length_in_bytes: Length of @text, in bytes
+ * @compact_emoji: Whether emoji sequences count as a single character
+ * @max_weight: The weighted length the result has to fit in
+ *
+ * Emoji sequences are never cut in half, even when they are not counted
+ * as one character. @text is treated as a single token.
+ *
+ * Returns: The length of the longest prefix of @text that fits in @max_weight, in bytes
+ */
+static gsize
+truncate_chars (const char *text,
+                gsize       length_in_bytes,
+                gboolean    compact_emoji,
+                gsize       max_weight)
+{
+  const char *p = text;
+  const char *end = text + length_in_bytes;
+  EmojiSequence sequence = { CHARTYPE_NONE, 0, FALSE, '\0' };
+  gsize compact_weight = 0;
+  gsize weight = 0;
+  gsize prefix_length = 0;
+
+  while (p < end) {
+    const gunichar c = g_utf8_get_char (p);
+    const guint props = char_properties (c);
+
+    if (!emoji_sequence_next (&sequence, c, props, &compact_weight)) {
+      // c starts something new, so the text can be cut before it
+      const gsize prefix_weight = compact_emoji ? compact_weight - char_weight (props) : weight;
+
+      if (prefix_weight > max_weight) {
+        return prefix_length;
       }
-      paren_level --;
+      prefix_length = p - text;
     }
 
-    i ++;
-
-    if (i == n_tokens) {
-      i --;
-      break;
-    }
+    weight += char_weight (props);
+    p = g_utf8_next_char (p);
   }
 
-  if (paren_level != 0) {
-    g_assert (first_paren_index != -1);
-    i = first_paren_index - 1; // Before that paren
+  if ((compact_emoji ? compact_weight + sequence.carry_weight : weight) <= max_weight) {
+    return length_in_bytes;
   }
 
-  t = &tokens[i];
-  /* Whatever happened, don't count trailing punctuation */
-  if (token_in (t, INVALID_AFTER_URL_CHARS)) {
-    i --;
-  }
+  return prefix_length;
+}
 
-  *current_position = i;
+/*
+ * Where the parse functions put the entities they find. The total length of
+ * all entities is always kept, which is all the count functions need. If
+ * @entities is not %NULL, the entities whose type is in @entity_mask are also
+ * appended to it as soon as they are found. Otherwise, they are passed to
+ * @entity_func if that is set.
+ */
+typedef struct {
+  GArray *entities;
+  gsize length_in_characters;
+  gsize length_in_weighted_characters;
+  // Counting stops at the first entity that takes the weighted length past @limit
+  gsize limit;
+  gboolean compact_emoji;
+  // Where the text has to be cut to fit in @limit, once it has been crossed
+  const char *truncation_point;
+  // #TlEntityMask of the entities to keep
+  guint entity_mask;
+  TlEntityFunc entity_func;
+  gpointer user_data;
+  // Whether entities are weighted without compacting emoji even if @compact_emoji is set, like
+  // tl_extract_entities() does. Their compact weights are then appended to @compact_weights, unless it is %NULL.
+  gboolean plain_entity_weights;
+  GArray *compact_weights;
+} EntitySink;
 
-  return TRUE;
+/*
+ * extract_mask:
+ * @flags: #TlExtractFlags
+ *
+ * Returns: The #TlEntityMask of the entities extracting with @flags returns
+ */
+static inline guint
+extract_mask (guint flags)
+{
+  return TL_ENTITY_MASK_LINK | TL_ENTITY_MASK_MENTION | TL_ENTITY_MASK_HASHTAG |
+         ((flags & TL_EXTRACT_TEXT) != 0 ? TL_ENTITY_MASK_TEXT : 0);
 }
 
+static inline gboolean
+sink_keeps_entities (const EntitySink *sink)
+{
+  return sink->entities != NULL || sink->entity_func != NULL;
+}
 
-// Returns whether a link has been parsed or not.
-static gboolean
-parse_link (GArray      *entities,
-            const Token *tokens,
-            gsize        n_tokens,
-            guint       *current_position)
+static inline void
+emit_entity (EntitySink   *sink,
+             const Tokens *tokens,
+             guint         entity_type,
+             guint         start_token_index,
+             guint         end_token_index)
 {
-  guint i = *current_position;
-  const Token *t;
-  guint start_token = *current_position;
-  guint end_token;
-  gboolean has_protocol = FALSE;
+  const char *start = token_start (tokens, start_token_index);
+  const guint end = end_token_index + 1;
+  gsize length_in_characters;
+  gsize length_in_weighted_characters;
 
-  t = &tokens[i];
+  if (sink_keeps_entities (sink) &&
+      (sink->entity_mask & (1 << entity_type)) != 0) {
+    TlEntity e;
 
-  // Some may not even appear before a protocol
-  if (i > 0 && token_in (&tokens[i - 1], INVALID_BEFORE_URL_CHARS)) {
-    return FALSE;
-  }
+    entity_for_tokens (&e, tokens, entity_type, start_token_index, end_token_index);
 
-  if (token_is_protocol (t)) {
-    // need "://" now.
-    t = &tokens[i + 1];
-    if (t->type != TOK_COLON) {
-      return FALSE;
-    }
-    i ++;
+    if (sink->plain_entity_weights) {
+      if (sink->compact_weights != NULL) {
+        const guint32 compact_weight = e.length_in_weighted_characters;
 
-    t = &tokens[i + 1];
-    if (t->type != TOK_SLASH) {
-      return FALSE;
+        g_array_append_val (sink->compact_weights, compact_weight);
+      }
+      e.length_in_weighted_characters = (guint32)(tokens->plain_weighted_offsets[end] -
+                                                  tokens->plain_weighted_offsets[start_token_index]);
     }
-    i ++;
 
-    t = &tokens[i + 1];
-    if (t->type != TOK_SLASH) {
-      return FALSE;
-    }
-    // If we are at the end now, this is not a link, just the protocol.
-    if (i + 1 == n_tokens - 1) {
-      return FALSE;
+    if (sink->entities != NULL) {
+      g_array_append_val (sink->entities, e);
+    } else {
+      sink->entity_func (&e, sink->user_data);
     }
-    i += 2; // Skip to token after second slash
-    has_protocol = TRUE;
+  }
+
+  if (entity_type == TL_ENT_LINK) {
+    length_in_characters = LINK_LENGTH;
+    length_in_weighted_characters = LINK_LENGTH;
   } else {
-    // Lookbehind: Token before may not be an @, they are not supported.
-    if (i > 0 && token_in (&tokens[i - 1], INVALID_BEFORE_NON_PROTOCOL_URL_CHARS)) {
-      return FALSE;
+    length_in_characters = tokens->character_offsets[end] - tokens->character_offsets[start_token_index];
+    length_in_weighted_characters = (guint32)(tokens->weighted_offsets[end] -
+                                              tokens->weighted_offsets[start_token_index]);
+  }
+
+  if (sink->length_in_weighted_characters + length_in_weighted_characters > sink->limit) {
+    // Links, mentions and hashtags are never cut in half, text and whitespace entities are single tokens.
+    // Text after a dot isn't either, since cutting it short could turn it into a TLD.
+    if ((entity_type == TL_ENT_TEXT || entity_type == TL_ENT_WHITESPACE) &&
+        !(start_token_index > 0 && tokens->types[start_token_index - 1] == TOK_DOT)) {
+      sink->truncation_point = start + truncate_chars (start,
+                                                       token_length_in_bytes (tokens, start_token_index),
+                                                       sink->compact_emoji,
+                                                       sink->limit - sink->length_in_weighted_characters);
+    } else {
+      sink->truncation_point = start;
+    }
+  }
+
+  sink->length_in_characters += length_in_characters;
+  sink->length_in_weighted_characters += length_in_weighted_characters;
+}
+
+/*
+ * ascii_run_length:
+ * @p: Start of the run
+ * @end: End of the input
+ * @digits: Whether to look for a run of digits rather than ASCII letters
+ *
+ * ASCII letters (TOK_TEXT) and digits (TOK_NUMBER) never split a token or carry
+ * any emoji state, so tokenizer_next() can skip over runs of them in bulk. This checks
+ * 32 (AVX2) or 16 (SSE2) bytes at a time where possible.
+ *
+ * Returns: The number of bytes from @p that are all ASCII letters or all digits
+ */
+static inline gsize
+ascii_run_length (const char *p,
+                  const char *end,
+                  gboolean    digits)
+{
+  const char *start = p;
+  const char lowest = digits ? '0' : 'a';
+  const char highest = digits ? '9' : 'z';
+  // Setting 0x20 turns upper case into lower case and leaves digits alone
+  const char fold = digits ? 0 : 0x20;
+
+#if defined(__AVX2__)
+  const __m256i lowest_v = _mm256_set1_epi8 (lowest - 1);
+  const __m256i highest_v = _mm256_set1_epi8 (highest + 1);
+  const __m256i fold_v = _mm256_set1_epi8 (fold);
+
+  while (end - p >= 32) {
+    // Bytes >= 0x80 are negative as signed chars, so they fail the lower bound
+    const __m256i v = _mm256_or_si256 (_mm256_loadu_si256 ((const __m256i *)p), fold_v);
+    const __m256i in_range = _mm256_and_si256 (_mm256_cmpgt_epi8 (v, lowest_v),
+                                               _mm256_cmpgt_epi8 (highest_v, v));
+    const guint32 mask = (guint32)_mm256_movemask_epi8 (in_range);
+
+    if (mask != 0xFFFFFFFF) {
+      return (p - start) + __builtin_ctz (~mask);
+    }
+    p += 32;
+  }
+#elif defined(__SSE2__)
+  const __m128i lowest_v = _mm_set1_epi8 (lowest - 1);
+  const __m128i highest_v = _mm_set1_epi8 (highest + 1);
+  const __m128i fold_v = _mm_set1_epi8 (fold);
+
+  while (end - p >= 16) {
+    // Bytes >= 0x80 are negative as signed chars, so they fail the lower bound
+    const __m128i v = _mm_or_si128 (_mm_loadu_si128 ((const __m128i *)p), fold_v);
+    const __m128i in_range = _mm_and_si128 (_mm_cmpgt_epi8 (v, lowest_v),
+                                            _mm_cmplt_epi8 (v, highest_v));
+    const guint mask = (guint)_mm_movemask_epi8 (in_range);
+
+    if (mask != 0xFFFF) {
+      return (p - start) + __builtin_ctz (~mask);
+    }
+    p += 16;
+  }
+#endif
+
+  while (p < end && (*p | fold) >= lowest && (*p | fold) <= highest) {
+    p ++;
+  }
+
+  return p - start;
+}
+
+/*
+ * find_any_byte:
+ * @p: Where to start looking
+ * @end: End of the input
+ *
+ * Checks 32 (AVX2) or 16 (SSE2) bytes at a time where possible.
+ *
+ * Returns: The first @a, @b or @c from @p on, or @end if there is none
+ */
+static inline const char *
+find_any_byte (const char *p,
+               const char *end,
+               char        a,
+               char        b,
+               char        c)
+{
+#if defined(__AVX2__)
+  const __m256i dot_v = _mm256_set1_epi8 (a);
+  const __m256i at_v = _mm256_set1_epi8 (b);
+  const __m256i hash_v = _mm256_set1_epi8 (c);
+
+  while (end - p >= 32) {
+    const __m256i v = _mm256_loadu_si256 ((const __m256i *)p);
+    const __m256i found = _mm256_or_si256 (_mm256_or_si256 (_mm256_cmpeq_epi8 (v, dot_v),
+                                                            _mm256_cmpeq_epi8 (v, at_v)),
+                                           _mm256_cmpeq_epi8 (v, hash_v));
+    const guint32 mask = (guint32)_mm256_movemask_epi8 (found);
+
+    if (mask != 0) {
+      return p + __builtin_ctz (mask);
+    }
+    p += 32;
+  }
+#elif defined(__SSE2__)
+  const __m128i dot_v = _mm_set1_epi8 (a);
+  const __m128i at_v = _mm_set1_epi8 (b);
+  const __m128i hash_v = _mm_set1_epi8 (c);
+
+  while (end - p >= 16) {
+    const __m128i v = _mm_loadu_si128 ((const __m128i *)p);
+    const __m128i found = _mm_or_si128 (_mm_or_si128 (_mm_cmpeq_epi8 (v, dot_v),
+                                                      _mm_cmpeq_epi8 (v, at_v)),
+                                        _mm_cmpeq_epi8 (v, hash_v));
+    const guint mask = (guint)_mm_movemask_epi8 (found);
+
+    if (mask != 0) {
+      return p + __builtin_ctz (mask);
+    }
+    p += 16;
+  }
+#endif
+
+  while (p < end && *p != a && *p != b && *p != c) {
+    p ++;
+  }
+
+  return p;
+}
+
+/*
+ * find_any_byte_counting:
+ * @p: Where to start looking
+ * @end: End of the input
+ * @n_characters: (inout): Incremented by the number of characters skipped
+ * @n_utf16_units: (inout): Incremented by the number of UTF-16 code units skipped
+ *
+ * Like find_any_byte(), but also counts the text it skips, the same way
+ * utf16_length() does: every byte that isn't a continuation byte starts a
+ * character, and those of four bytes take two UTF-16 code units.
+ *
+ * Returns: The first @a, @b or @c from @p on, or @end if there is none
+ */
+static inline const char *
+find_any_byte_counting (const char *p,
+                        const char *end,
+                        char        a,
+                        char        b,
+                        char        c,
+                        gsize      *n_characters,
+                        gsize      *n_utf16_units)
+{
+  gsize characters = 0;
+  gsize supplementary = 0;
+
+#if defined(__AVX2__)
+  const __m256i dot_v = _mm256_set1_epi8 (a);
+  const __m256i at_v = _mm256_set1_epi8 (b);
+  const __m256i hash_v = _mm256_set1_epi8 (c);
+  // As signed bytes, continuation bytes are -128 to -65 and four byte leads -16 to -1
+  const __m256i last_continuation_v = _mm256_set1_epi8 (-65);
+  const __m256i before_four_byte_v = _mm256_set1_epi8 (-17);
+  const __m256i zero_v = _mm256_setzero_si256 ();
+
+  while (end - p >= 32) {
+    const __m256i v = _mm256_loadu_si256 ((const __m256i *)p);
+    const __m256i found = _mm256_or_si256 (_mm256_or_si256 (_mm256_cmpeq_epi8 (v, dot_v),
+                                                            _mm256_cmpeq_epi8 (v, at_v)),
+                                           _mm256_cmpeq_epi8 (v, hash_v));
+    const guint32 mask = (guint32)_mm256_movemask_epi8 (found);
+    guint32 starts = (guint32)_mm256_movemask_epi8 (_mm256_cmpgt_epi8 (v, last_continuation_v));
+    guint32 four_byte = (guint32)_mm256_movemask_epi8 (_mm256_and_si256 (_mm256_cmpgt_epi8 (v, before_four_byte_v),
+                                                                         _mm256_cmpgt_epi8 (zero_v, v)));
+
+    if (mask != 0) {
+      // Only the bytes before the match
+      starts &= (mask & -mask) - 1;
+      four_byte &= (mask & -mask) - 1;
+    }
+    characters += __builtin_popcount (starts);
+    supplementary += __builtin_popcount (four_byte);
+
+    if (mask != 0) {
+      *n_characters += characters;
+      *n_utf16_units += characters + supplementary;
+      return p + __builtin_ctz (mask);
     }
+    p += 32;
+  }
+#elif defined(__SSE2__)
+  const __m128i dot_v = _mm_set1_epi8 (a);
+  const __m128i at_v = _mm_set1_epi8 (b);
+  const __m128i hash_v = _mm_set1_epi8 (c);
+  // As signed bytes, continuation bytes are -128 to -65 and four byte leads -16 to -1
+  const __m128i last_continuation_v = _mm_set1_epi8 (-65);
+  const __m128i before_four_byte_v = _mm_set1_epi8 (-17);
+  const __m128i zero_v = _mm_setzero_si128 ();
+
+  while (end - p >= 16) {
+    const __m128i v = _mm_loadu_si128 ((const __m128i *)p);
+    const __m128i found = _mm_or_si128 (_mm_or_si128 (_mm_cmpeq_epi8 (v, dot_v),
+                                                      _mm_cmpeq_epi8 (v, at_v)),
+                                        _mm_cmpeq_epi8 (v, hash_v));
+    const guint mask = (guint)_mm_movemask_epi8 (found);
+    guint starts = (guint)_mm_movemask_epi8 (_mm_cmpgt_epi8 (v, last_continuation_v));
+    guint four_byte = (guint)_mm_movemask_epi8 (_mm_and_si128 (_mm_cmpgt_epi8 (v, before_four_byte_v),
+                                                               _mm_cmpgt_epi8 (zero_v, v)));
+
+    if (mask != 0) {
+      // Only the bytes before the match
+      starts &= (mask & -mask) - 1;
+      four_byte &= (mask & -mask) - 1;
+    }
+    characters += __builtin_popcount (starts);
+    supplementary += __builtin_popcount (four_byte);
+
+    if (mask != 0) {
+      *n_characters += characters;
+      *n_utf16_units += characters + supplementary;
+      return p + __builtin_ctz (mask);
+    }
+    p += 16;
+  }
+#endif
+
+  while (p < end && *p != a && *p != b && *p != c) {
+    characters += ((guchar)*p & 0xC0) != 0x80;
+    supplementary += (guchar)*p >= 0xF0;
+    p ++;
+  }
+
+  *n_characters += characters;
+  *n_utf16_units += characters + supplementary;
+
+  return p;
+}
+
+/*
+ * find_entity_candidate:
+ * @p: Where to start looking
+ * @end: End of the input
+ *
+ * Links need a TOK_DOT, mentions a TOK_AT and hashtags a TOK_HASH, and
+ * only the ASCII '.', '@' and '#' start those tokens. A text without any
+ * of them has no entities at all.
+ *
+ * Returns: The first '.', '@' or '#' from @p on, or @end if there is none
+ */
+static inline const char *
+find_entity_candidate (const char *p,
+                       const char *end)
+{
+  return find_any_byte (p, end, '.', '@', '#');
+}
+
+/*
+ * Tokenizer state between two tokens. Every token is read from scratch, so
+ * this is just the position in the input.
+ */
+typedef struct {
+  const char *p;
+  const char *end;
+  gsize character_index;
+  gsize utf16_index;
+  gsize weighted_index;
+  // The weighted length so far without compacting emoji, if compact_emoji is set
+  gsize plain_weighted_index;
+  gboolean compact_emoji;
+} Tokenizer;
+
+static inline void
+tokenizer_init (Tokenizer  *tokenizer,
+                const char *input,
+                gsize       length_in_bytes,
+                gboolean    compact_emoji)
+{
+  tokenizer->p = input;
+  tokenizer->end = input + length_in_bytes;
+  tokenizer->character_index = 0;
+  tokenizer->utf16_index = 0;
+  tokenizer->weighted_index = 0;
+  tokenizer->plain_weighted_index = 0;
+  tokenizer->compact_emoji = compact_emoji;
+}
+
+/*
+ * tokens_start:
+ * @tokens: The tokens to empty
+ * @tokenizer: The tokenizer that will add tokens to @tokens
+ *
+ * Makes @tokens start at the current position of @tokenizer. @tokens needs
+ * room for at least one entry.
+ */
+static inline void
+tokens_start (Tokens          *tokens,
+              const Tokenizer *tokenizer)
+{
+  tokens->input = tokenizer->p;
+  tokens->character_base = tokenizer->character_index;
+  tokens->utf16_base = tokenizer->utf16_index;
+  tokens->byte_offsets[0] = 0;
+  tokens->character_offsets[0] = 0;
+  tokens->utf16_offsets[0] = 0;
+  tokens->weighted_offsets[0] = (guint32)tokenizer->weighted_index;
+  tokens->plain_weighted_offsets[0] = (guint32)tokenizer->plain_weighted_index;
+  tokens->types[0] = 0;
+  tokens->classes[0] = 0;
+  tokens->len = 0;
+}
+
+/*
+ * tokens_drop:
+ * @tokens: The tokens
+ * @n_tokens: The number of tokens to remove from the front of @tokens
+ */
+static inline void
+tokens_drop (Tokens *tokens,
+             gsize   n_tokens)
+{
+  const guint32 byte_offset = tokens->byte_offsets[n_tokens];
+  const guint32 character_offset = tokens->character_offsets[n_tokens];
+  const guint32 utf16_offset = tokens->utf16_offsets[n_tokens];
+  const gsize n_entries = tokens->len - n_tokens + 1;
+  gsize i;
+
+  for (i = 0; i < n_entries; i ++) {
+    tokens->byte_offsets[i] = tokens->byte_offsets[n_tokens + i] - byte_offset;
+    tokens->character_offsets[i] = tokens->character_offsets[n_tokens + i] - character_offset;
+    tokens->utf16_offsets[i] = tokens->utf16_offsets[n_tokens + i] - utf16_offset;
   }
+  memmove (tokens->weighted_offsets, &tokens->weighted_offsets[n_tokens], n_entries * sizeof (guint32));
+  memmove (tokens->plain_weighted_offsets, &tokens->plain_weighted_offsets[n_tokens], n_entries * sizeof (guint32));
+  memmove (tokens->types, &tokens->types[n_tokens], n_entries);
+  memmove (tokens->classes, &tokens->classes[n_tokens], n_entries * sizeof (guint16));
+
+  tokens->input += byte_offset;
+  tokens->character_base += character_offset;
+  tokens->utf16_base += utf16_offset;
+  tokens->len -= n_tokens;
+}
+
+/*
+ * tokens_copy:
+ * @dest: Tokens living in a #TlContext
+ * @src: The tokens to copy into @dest
+ */
+static void
+tokens_copy (Tokens       *dest,
+             const Tokens *src)
+{
+  const gsize n_entries = src->len + 1;
+
+  tokens_reserve (dest, src->len);
+  memcpy (dest->byte_offsets, src->byte_offsets, n_entries * sizeof (guint32));
+  memcpy (dest->character_offsets, src->character_offsets, n_entries * sizeof (guint32));
+  memcpy (dest->utf16_offsets, src->utf16_offsets, n_entries * sizeof (guint32));
+  memcpy (dest->weighted_offsets, src->weighted_offsets, n_entries * sizeof (guint32));
+  memcpy (dest->plain_weighted_offsets, src->plain_weighted_offsets, n_entries * sizeof (guint32));
+  memcpy (dest->types, src->types, n_entries);
+  memcpy (dest->classes, src->classes, n_entries * sizeof (guint16));
+
+  dest->input = src->input;
+  dest->character_base = src->character_base;
+  dest->utf16_base = src->utf16_base;
+  dest->len = src->len;
+}
+
+/*
+ * tokenizer_push:
+ * @tokenizer: The tokenizer
+ * @tokens: Tokens to append to
+ * @token_end: Where the token that starts at the position of @tokenizer ends
+ * @flags: TC_ASCII if the token is all ASCII, TC_ENDS_IN_ACCENTED if its last character isn't
+ *
+ * Appends that token to @tokens and moves @tokenizer past it.
+ */
+static inline void
+tokenizer_push (Tokenizer  *tokenizer,
+                Tokens     *tokens,
+                const char *token_end,
+                gsize       length_in_characters,
+                gsize       length_in_utf16_units,
+                gsize       length_in_weighted_characters,
+                gsize       length_in_plain_weighted_characters,
+                guint       flags)
+{
+  const gsize i = tokens->len;
+  const gsize length_in_bytes = token_end - tokenizer->p;
+
+  tokens->types[i] = token_type_from_char (tokenizer->p[0]);
+  tokens->types[i + 1] = 0;
+
+  // Only text of more than one byte can end in an accented character
+  if (length_in_bytes == 1 || tokens->types[i] != TOK_TEXT) {
+    flags &= ~TC_ENDS_IN_ACCENTED;
+  }
+  if (length_in_bytes == 1) {
+    flags |= BYTE_CLASSES[(guchar)tokenizer->p[0]];
+  }
+  tokens->classes[i] = flags;
+  tokens->classes[i + 1] = 0;
+  tokens->byte_offsets[i + 1] = tokens->byte_offsets[i] + length_in_bytes;
+  tokens->character_offsets[i + 1] = tokens->character_offsets[i] + length_in_characters;
+  tokens->utf16_offsets[i + 1] = tokens->utf16_offsets[i] + length_in_utf16_units;
+  tokens->weighted_offsets[i + 1] = tokens->weighted_offsets[i] + length_in_weighted_characters;
+  tokens->plain_weighted_offsets[i + 1] = tokens->plain_weighted_offsets[i] + length_in_plain_weighted_characters;
+  tokens->len ++;
+
+  tokenizer->p = token_end;
+  tokenizer->character_index += length_in_characters;
+  tokenizer->utf16_index += length_in_utf16_units;
+  tokenizer->weighted_index += length_in_weighted_characters;
+  tokenizer->plain_weighted_index += length_in_plain_weighted_characters;
+}
 
-  if (token_in (&tokens[i], INVALID_URL_CHARS)) {
+/*
+ * tokenizer_next:
+ * @tokenizer: The tokenizer
+ * @tokens: Tokens to append the next token to. They need room for one more token.
+ *
+ * Returns: %FALSE if the end of the input has been reached, %TRUE if a token has been added
+ */
+static inline gboolean
+tokenizer_next (Tokenizer *tokenizer,
+                Tokens    *tokens)
+{
+  const char *p = tokenizer->p;
+  const char *end = tokenizer->end;
+  const gboolean compact_emoji = tokenizer->compact_emoji;
+  gunichar cur_char;
+  guint cur_props;
+  gsize length_in_chars = 0;
+  gsize length_in_weighted_chars = 0;
+  gsize length_in_plain_weighted_chars = 0;
+  // Characters outside the BMP, which take two UTF-16 code units
+  gsize n_supplementary_chars = 0;
+  guint last_token_type = 0;
+  gunichar last_char = 0;
+  gboolean ascii = TRUE;
+  EmojiSequence sequence = { CHARTYPE_NONE, 0, FALSE, '\0' };
+
+  if (p >= end) {
     return FALSE;
   }
 
-  // Now read until .tld. There can be multiple (e.g. in http://foobar.com.com.com"),
-  // so we need to do this in a greedy way.
-  guint tld_index = i;
-  guint tld_iter = i;
-  gboolean tld_found = FALSE;
-  guint fragment_length = 0;
-
-  while (tld_iter < n_tokens - 1) {
-    const Token *t = &tokens[tld_iter];
-
-    if (t->type == TOK_WHITESPACE) {
-      if (!tld_found) {
-        return FALSE;
+  cur_char = g_utf8_get_char (p);
+  cur_props = char_properties (cur_char);
+
+  /* If this char already splits, it's a one-char token */
+  if (cur_props & CHAR_PROPS_SPLITS) {
+    tokenizer_push (tokenizer, tokens, g_utf8_next_char (p), 1, cur_char > 0xFFFF ? 2 : 1,
+                    char_weight (cur_props), char_weight (cur_props), cur_char < 128 ? TC_ASCII : 0);
+    return TRUE;
+  }
+
+  last_token_type = CHAR_PROPS_TOKEN_TYPE (cur_props);
+
+  do {
+    if (cur_char < 128) {
+      gsize run_length = ascii_run_length (p, end, last_token_type == TOK_NUMBER);
+
+      // All but the last character of the run are followed by another one of the same
+      // type, so they can't end the token. Leave the last one to the normal checks below.
+      if (run_length > 1) {
+        if (compact_emoji) {
+          // Any partial sequence is finished by the first character, same as below
+          length_in_weighted_chars += sequence.carry_weight;
+          sequence.carry_weight = 0;
+          sequence.is_zwjed = FALSE;
+          sequence.prev_char_type = CHARTYPE_UNWEIGHTED;
+        }
+
+        p += run_length - 1;
+        cur_char = (guchar)*p;
+        cur_props = char_properties (cur_char);
+        length_in_chars += run_length - 1;
+        length_in_weighted_chars += (run_length - 1) * UNWEIGHTED_VALUE;
+        length_in_plain_weighted_chars += (run_length - 1) * UNWEIGHTED_VALUE;
       }
     }
 
-    if (!(t->type == TOK_NUMBER ||
-          t->type == TOK_TEXT ||
-          t->type == TOK_DOT ||
-          t->type == TOK_DASH)) {
-      if (!tld_found) {
-        return FALSE;
+    if (cur_char > 127) {
+      ascii = FALSE;
+      n_supplementary_chars += cur_char > 0xFFFF;
+    }
+    last_char = cur_char;
+
+    if (compact_emoji) {
+      emoji_sequence_next (&sequence, cur_char, cur_props, &length_in_weighted_chars);
+    }
+    else {
+      length_in_weighted_chars += char_weight (cur_props);
+    }
+    length_in_plain_weighted_chars += char_weight (cur_props);
+
+    p = g_utf8_next_char (p);
+    cur_char = g_utf8_get_char (p);
+    cur_props = char_properties (cur_char);
+    length_in_chars ++;
+
+    if (CHAR_PROPS_TOKEN_TYPE (cur_props) != last_token_type) {
+      break;
+    }
+
+  } while (!(cur_props & CHAR_PROPS_SPLITS) &&
+           p < end);
+
+  length_in_weighted_chars += sequence.carry_weight;
+  tokenizer_push (tokenizer, tokens, p, length_in_chars, length_in_chars + n_supplementary_chars,
+                  length_in_weighted_chars, length_in_plain_weighted_chars,
+                  (ascii ? TC_ASCII : 0) | (last_char > 127 ? TC_ENDS_IN_ACCENTED : 0));
+
+  return TRUE;
+}
+
+static inline gboolean
+token_is_host_part (guint type)
+{
+  return type == TOK_NUMBER ||
+         type == TOK_TEXT ||
+         type == TOK_DOT ||
+         type == TOK_DASH;
+}
+
+static inline gsize
+host_fragment_length (const Tokens *tokens,
+                      gsize         token_index)
+{
+  const gsize length_in_characters = token_length_in_characters (tokens, token_index);
+  gsize length_in_weighted_characters;
+
+  if (token_in (tokens, token_index, TC_ASCII)) {
+    return length_in_characters;
+  }
+
+  // Not the weighted length of the token, which compacted emoji would make depend on the
+  // count mode (and even shorter than the token is long)
+  length_in_weighted_characters = text_weight (token_start (tokens, token_index),
+                                               token_length_in_bytes (tokens, token_index),
+                                               FALSE);
+
+  // Approximate some rules for handling Punycode. This may not be perfect, but it should be good enough and rarely hit.
+  // And it passes Twitter's test case!
+  if (length_in_characters != length_in_weighted_characters) {
+    gsize unicode_chars = length_in_weighted_characters - length_in_characters;
+    gsize ascii_ish_chars = length_in_characters - unicode_chars;
+    return ascii_ish_chars + ((((unicode_chars * 100) / 5) * 6) / 100) + 1;
+  }
+
+  return length_in_characters;
+}
+
+/*
+ * scan_hosts:
+ *
+ * Walks @tokens backwards once and records, for every token, where the last
+ * TLD of the host run starting there is and whether that run contains an
+ * over-long fragment into @hosts, which has room for @n_tokens entries.
+ * The last token never starts a link, so it never gets a TLD.
+ */
+static void
+scan_hosts (const Tokens *tokens,
+            gsize         n_tokens,
+            HostInfo     *hosts)
+{
+  gsize i;
+
+  if (n_tokens == 0) {
+    return;
+  }
+
+  hosts[n_tokens - 1].tld_dot_index = NO_TLD;
+  hosts[n_tokens - 1].fragment_length = 0;
+  hosts[n_tokens - 1].fragment_too_long = FALSE;
+
+  for (i = n_tokens - 1; i -- > 0;) {
+    const guint type = tokens->types[i];
+    const HostInfo *next = &hosts[i + 1];
+    HostInfo *h = &hosts[i];
+
+    if (!token_is_host_part (type)) {
+      h->tld_dot_index = NO_TLD;
+      h->fragment_length = 0;
+      h->fragment_too_long = FALSE;
+      continue;
+    }
+
+    if (type == TOK_DOT) {
+      h->fragment_length = 0;
+      h->fragment_too_long = next->fragment_too_long;
+
+      // Only look the TLD up if there isn't a later one in the run already
+      if (next->tld_dot_index != NO_TLD) {
+        h->tld_dot_index = next->tld_dot_index;
+      } else if (token_is_tld (tokens, i + 1)) {
+        h->tld_dot_index = i;
       } else {
-        break;
+        h->tld_dot_index = NO_TLD;
+      }
+    } else {
+      gsize fragment_length = host_fragment_length (tokens, i);
+
+      if (fragment_length <= 63) {
+        fragment_length += next->fragment_length;
       }
+
+      h->fragment_length = MIN (fragment_length, 64);
+      h->fragment_too_long = next->fragment_too_long || fragment_length > 63;
+      h->tld_dot_index = next->tld_dot_index;
+    }
+  }
+}
+
+static gboolean
+parse_link_tail (const Tokens *tokens,
+                 gsize         n_tokens,
+                 guint        *current_position)
+{
+  guint i = *current_position;
+
+  gsize paren_level = 0;
+  int first_paren_index = -1;
+  for (;;) {
+    if (tokens->types[i] == TOK_WHITESPACE || tokens->types[i] == TOK_APOSTROPHE) {
+      i --;
+      break;
     }
 
-    if (t->type != TOK_DOT) {
-      // Approximate some rules for handling Punycode. This may not be perfect, but it should be good enough and rarely hit.
-      // And it passes Twitter's test case!
-      if (t->length_in_characters != t->length_in_weighted_characters) {
-        gsize unicode_chars = t->length_in_weighted_characters - t->length_in_characters;
-        gsize ascii_ish_chars = t->length_in_characters - unicode_chars;
-        fragment_length += ascii_ish_chars + ((((unicode_chars * 100) / 5) * 6) / 100) + 1;
+    if (tokens->types[i] == TOK_OPEN_PAREN) {
+
+      if (first_paren_index == -1) {
+        first_paren_index = i;
       }
-      else {
-        fragment_length += t->length_in_characters;
+      paren_level ++;
+      if (paren_level == 3) {
+        break;
       }
-      if (fragment_length > 63) {
-        return FALSE;
+    } else if (tokens->types[i] == TOK_CLOSE_PAREN) {
+      if (first_paren_index == -1) {
+        first_paren_index = i;
       }
+      paren_level --;
     }
-    else {
-      fragment_length = 0;
+
+    i ++;
+
+    if (i == n_tokens) {
+      i --;
+      break;
+    }
+  }
+
+  if (paren_level != 0) {
+    g_assert (first_paren_index != -1);
+    i = first_paren_index - 1; // Before that paren
+  }
+
+  /* Whatever happened, don't count trailing punctuation */
+  if (token_in (tokens, i, TC_INVALID_AFTER_URL)) {
+    i --;
+  }
+
+  *current_position = i;
+
+  return TRUE;
+}
+
+
+// Returns whether a link has been parsed or not.
+static gboolean
+parse_link (EntitySink     *sink,
+            const Tokens   *tokens,
+            const HostInfo *hosts,
+            gsize           n_tokens,
+            guint          *current_position)
+{
+  guint i = *current_position;
+  guint start_token = *current_position;
+  guint end_token;
+
+  // Some may not even appear before a protocol
+  if (i > 0 && token_in (tokens, i - 1, TC_INVALID_BEFORE_URL)) {
+    return FALSE;
+  }
+
+  if (token_is_protocol (tokens, i)) {
+    // need "://" now.
+    if (tokens->types[i + 1] != TOK_COLON) {
+      return FALSE;
+    }
+    i ++;
+
+    if (tokens->types[i + 1] != TOK_SLASH) {
+      return FALSE;
     }
+    i ++;
 
-    if (t->type == TOK_DOT &&
-        token_is_tld (&tokens[tld_iter + 1], has_protocol)) {
-      tld_index = tld_iter;
-      tld_found = TRUE;
+    if (tokens->types[i + 1] != TOK_SLASH) {
+      return FALSE;
     }
+    // If we are at the end now, this is not a link, just the protocol.
+    if (i + 1 == n_tokens - 1) {
+      return FALSE;
+    }
+    i += 2; // Skip to token after second slash
+  } else {
+    // Lookbehind: Token before may not be an @, they are not supported.
+    if (i > 0 && token_in (tokens, i - 1, TC_INVALID_BEFORE_NON_PROTOCOL_URL)) {
+      return FALSE;
+    }
+  }
+
+  if (token_in (tokens, i, TC_INVALID_URL)) {
+    return FALSE;
+  }
 
-    tld_iter ++;
+  // Now read until .tld. There can be multiple (e.g. in http://foobar.com.com.com"),
+  // so we need to do this in a greedy way. scan_hosts() has already done that for
+  // every token, so this is just a lookup.
+  if (hosts[i].fragment_too_long) {
+    return FALSE;
   }
 
-  if (tld_index >= n_tokens - 1 ||
-      !tld_found ||
-      token_in (&tokens[tld_index - 1], INVALID_URL_CHARS)) {
+  guint tld_index = hosts[i].tld_dot_index;
+
+  if (tld_index == NO_TLD ||
+      token_in (tokens, tld_index - 1, TC_INVALID_URL)) {
     return FALSE;
   }
 
   // tld_index is the TOK_DOT
-  g_assert (tokens[tld_index].type == TOK_DOT);
+  g_assert (tokens->types[tld_index] == TOK_DOT);
   i = tld_index + 1;
 
   // If the next token is a colon, we are reading a port
-  if (i < n_tokens - 1 && tokens[i + 1].type == TOK_COLON) {
+  if (i < n_tokens - 1 && tokens->types[i + 1] == TOK_COLON) {
     i ++; // i == COLON
-    if (tokens[i + 1].type != TOK_NUMBER) {
+    if (tokens->types[i + 1] != TOK_NUMBER) {
       // According to twitter.com, the link reaches until before the COLON
       i --;
     } else {
@@ -1076,19 +1608,19 @@ parse_link (GArray      *entities,
   // If it isn't, we stop here.
   if (i < n_tokens - 1) {
     // A trailing slash is part of the link, other punctuation is not.
-    if (tokens[i + 1].type == TOK_SLASH ||
-        tokens[i + 1].type == TOK_QUESTIONMARK) {
+    if (tokens->types[i + 1] == TOK_SLASH ||
+        tokens->types[i + 1] == TOK_QUESTIONMARK) {
       i ++;
 
       if (i < n_tokens - 1) {
-        if (!parse_link_tail (entities, tokens, n_tokens, &i)) {
+        if (!parse_link_tail (tokens, n_tokens, &i)) {
           return FALSE;
         }
-      } else if (tokens[i].type == TOK_QUESTIONMARK) {
+      } else if (tokens->types[i] == TOK_QUESTIONMARK) {
         // Trailing questionmark is not part of the link
         i --;
       }
-    } else if (tokens[i + 1].type == TOK_AT) {
+    } else if (tokens->types[i + 1] == TOK_AT) {
       // We cannot just return FALSE for all non-slash/non-questionmark tokens here since
       // The Rules say some of them make a link until this token and some of them cause the
       // entire parsing to produce no link at all, like in the @ case (don't want to turn
@@ -1100,11 +1632,11 @@ parse_link (GArray      *entities,
   end_token = i;
   g_assert (end_token < n_tokens);
 
-  emplace_entity_for_tokens (entities,
-                             tokens,
-                             TL_ENT_LINK,
-                             start_token,
-                             end_token);
+  emit_entity (sink,
+               tokens,
+               TL_ENT_LINK,
+               start_token,
+               end_token);
 
   *current_position = end_token + 1; // Hop to the next token!
 
@@ -1112,31 +1644,31 @@ parse_link (GArray      *entities,
 }
 
 static gboolean
-parse_mention (GArray      *entities,
-               const Token *tokens,
-               gsize        n_tokens,
-               guint       *current_position)
+parse_mention (EntitySink   *sink,
+               const Tokens *tokens,
+               gsize         n_tokens,
+               guint        *current_position)
 {
   guint i = *current_position;
   const guint start_token = i;
   guint end_token;
 
-  g_assert (tokens[i].type == TOK_AT);
+  g_assert (tokens->types[i] == TOK_AT);
 
   // Lookback at the previous token. If it was a text token
   // without whitespace between, this is not going to be a mention...
   if (i > 0) {
     // Text tokens before an @-token generally destroy the mention,
     // except in a few cases...
-    if (tokens[i - 1].type == TOK_TEXT &&
-        !token_in (&tokens[i - 1], VALID_BEFORE_MENTION_CHARS) &&
-        !token_ends_in_accented (&tokens[i - 1])) {
+    if (tokens->types[i - 1] == TOK_TEXT &&
+        !token_in (tokens, i - 1, TC_VALID_BEFORE_MENTION) &&
+        !token_ends_in_accented (tokens, i - 1)) {
       return FALSE;
     }
 
     // Numbers and special invalid chars always ruin the mention
-    if (tokens[i - 1].type == TOK_NUMBER ||
-        token_in (&tokens[i - 1], INVALID_BEFORE_MENTION_CHARS)) {
+    if (tokens->types[i - 1] == TOK_NUMBER ||
+        token_in (tokens, i - 1, TC_INVALID_BEFORE_MENTION)) {
       return FALSE;
     }
   }
@@ -1150,33 +1682,22 @@ parse_mention (GArray      *entities,
       break;
     }
 
-    if (token_in (&tokens[i], INVALID_MENTION_CHARS)) {
+    if (token_in (tokens, i, TC_INVALID_MENTION)) {
       i --;
       break;
     }
 
-    if (tokens[i].type != TOK_TEXT &&
-        tokens[i].type != TOK_NUMBER &&
-        tokens[i].type != TOK_UNDERSCORE) {
+    if (tokens->types[i] != TOK_TEXT &&
+        tokens->types[i] != TOK_NUMBER &&
+        tokens->types[i] != TOK_UNDERSCORE) {
       i --;
       break;
     }
 
-    if (tokens[i].type == TOK_TEXT) {
-      const char *text = tokens[i].start;
-      // Special rules apply about what characters may appear in a @screen_name
-      const char *p = text;
-
-      while (p - text < (long)tokens[i].length_in_bytes) {
-        gunichar c = g_utf8_get_char (p);
-
-        if (!is_valid_mention_char (c)) {
-          return FALSE;
-        }
-
-        p = g_utf8_next_char (p);
-      }
-
+    // Special rules apply about what characters may appear in a @screen_name: just ASCII
+    if (tokens->types[i] == TOK_TEXT &&
+        !token_in (tokens, i, TC_ASCII)) {
+      return FALSE;
     }
 
     i ++;
@@ -1188,18 +1709,18 @@ parse_mention (GArray      *entities,
 
   // Mentions ending in an '@' are no mentions, e.g. @_@
   if (i < n_tokens - 1 &&
-      tokens[i + 1].type == TOK_AT) {
+      tokens->types[i + 1] == TOK_AT) {
     return FALSE;
   }
 
   end_token = i;
   g_assert (end_token < n_tokens);
 
-  emplace_entity_for_tokens (entities,
-                             tokens,
-                             TL_ENT_MENTION,
-                             start_token,
-                             end_token);
+  emit_entity (sink,
+               tokens,
+               TL_ENT_MENTION,
+               start_token,
+               end_token);
 
   *current_position = end_token + 1; // Hop to the next token!
 
@@ -1207,27 +1728,27 @@ parse_mention (GArray      *entities,
 }
 
 static gboolean
-parse_hashtag (GArray      *entities,
-               const Token *tokens,
-               gsize        n_tokens,
-               guint       *current_position)
+parse_hashtag (EntitySink   *sink,
+               const Tokens *tokens,
+               gsize         n_tokens,
+               guint        *current_position)
 {
   gsize i = *current_position;
   const guint start_token = i;
   guint end_token;
   gboolean text_found = FALSE;
 
-  g_assert (tokens[i].type == TOK_HASH);
+  g_assert (tokens->types[i] == TOK_HASH);
 
   // Lookback at the previous token. If it was a text token
   // without whitespace between, this is not going to be a mention...
-  if (i > 0 && tokens[i - 1].type == TOK_TEXT &&
-      !token_in (&tokens[i - 1], VALID_BEFORE_HASHTAG_CHARS)) {
+  if (i > 0 && tokens->types[i - 1] == TOK_TEXT &&
+      !token_in (tokens, i - 1, TC_VALID_BEFORE_HASHTAG)) {
     return FALSE;
   }
 
   // Some chars make the entire hashtag invalid
-  if (i > 0 && token_in (&tokens[i - 1], INVALID_BEFORE_HASHTAG_CHARS)) {
+  if (i > 0 && token_in (tokens, i - 1, TC_INVALID_BEFORE_HASHTAG)) {
     return FALSE;
   }
 
@@ -1235,17 +1756,17 @@ parse_hashtag (GArray      *entities,
   i ++;
 
   for (; i < n_tokens; i ++) {
-    if (token_in (&tokens[i], INVALID_HASHTAG_CHARS)) {
+    if (token_in (tokens, i, TC_INVALID_HASHTAG)) {
       break;
     }
 
-    if (tokens[i].type != TOK_TEXT &&
-        tokens[i].type != TOK_NUMBER &&
-        tokens[i].type != TOK_UNDERSCORE) {
+    if (tokens->types[i] != TOK_TEXT &&
+        tokens->types[i] != TOK_NUMBER &&
+        tokens->types[i] != TOK_UNDERSCORE) {
       break;
     }
 
-    text_found |= tokens[i].type == TOK_TEXT;
+    text_found |= tokens->types[i] == TOK_TEXT;
   }
 
   if (!text_found) {
@@ -1255,11 +1776,11 @@ parse_hashtag (GArray      *entities,
   end_token = i - 1;
   g_assert (end_token < n_tokens);
 
-  emplace_entity_for_tokens (entities,
-                             tokens,
-                             TL_ENT_HASHTAG,
-                             start_token,
-                             end_token);
+  emit_entity (sink,
+               tokens,
+               TL_ENT_HASHTAG,
+               start_token,
+               end_token);
 
   *current_position = end_token + 1; // Hop to the next token!
 
@@ -1267,465 +1788,3580 @@ parse_hashtag (GArray      *entities,
 }
 
 /*
- * parse:
- *
- * Returns: (transfer full): list of tokens
+ * parse_tokens:
+ * @sink: Where to put the entities
+ * @tokens: The tokens to parse
+ * @hosts: scan_hosts() results for @tokens
+ * @n_tokens: The number of tokens in @tokens
+ * @end: Index of the first token that should not start an entity
  */
-static GArray *
-parse (const Token *tokens,
-       gsize        n_tokens,
-       gboolean     extract_text_entities,
-       guint       *n_relevant_entities)
+static void
+parse_tokens (EntitySink     *sink,
+              const Tokens   *tokens,
+              const HostInfo *hosts,
+              gsize           n_tokens,
+              gsize           end)
 {
-  GArray *entities = g_array_new (FALSE, TRUE, sizeof (TlEntity));
   guint i = 0;
-  guint relevant_entities = 0;
 
-  while (i < n_tokens) {
-    const Token *token = &tokens[i];
+  while (i < end && sink->truncation_point == NULL) {
+    const guint type = tokens->types[i];
 
     // We always have to do this since links can begin with whatever word
-    if (parse_link (entities, tokens, n_tokens, &i)) {
-      relevant_entities ++;
+    if (parse_link (sink, tokens, hosts, n_tokens, &i)) {
       continue;
     }
 
-    switch (token->type) {
+    switch (type) {
       case TOK_AT:
-        if (parse_mention (entities, tokens, n_tokens, &i)) {
-          relevant_entities ++;
+        if (parse_mention (sink, tokens, n_tokens, &i)) {
           continue;
         }
       break;
 
       case TOK_HASH:
-        if (parse_hashtag (entities, tokens, n_tokens, &i)) {
-          relevant_entities ++;
+        if (parse_hashtag (sink, tokens, n_tokens, &i)) {
           continue;
         }
       break;
     }
 
-    if (extract_text_entities &&
-        token->type == TOK_TEXT) {
-      relevant_entities ++;
+    emit_entity (sink,
+                 tokens,
+                 type == TOK_TEXT ? TL_ENT_TEXT : TL_ENT_WHITESPACE,
+                 i, i);
+
+    i ++;
+  }
+}
+
+/*
+ * emit_plain_tokens:
+ * @sink: Where to put the entities
+ * @tokens: The tokens
+ * @first: Index of the first token to emit
+ * @end: Index of the first token not to emit
+ *
+ * Emits tokens that are known not to be part of a link, mention or hashtag,
+ * as text or whitespace entities of their own, the way parse_tokens() would.
+ */
+static inline void
+emit_plain_tokens (EntitySink   *sink,
+                   const Tokens *tokens,
+                   gsize         first,
+                   gsize         end)
+{
+  const gsize length_in_weighted_characters = (guint32)(tokens->weighted_offsets[end] - tokens->weighted_offsets[first]);
+  gsize i;
+
+  if (!(sink_keeps_entities (sink) && (sink->entity_mask & TL_ENTITY_MASK_TEXT) != 0) &&
+      sink->length_in_weighted_characters + length_in_weighted_characters <= sink->limit) {
+    sink->length_in_characters += tokens->character_offsets[end] - tokens->character_offsets[first];
+    sink->length_in_weighted_characters += length_in_weighted_characters;
+    return;
+  }
+
+  for (i = first; i < end && sink->truncation_point == NULL; i ++) {
+    emit_entity (sink,
+                 tokens,
+                 tokens->types[i] == TOK_TEXT ? TL_ENT_TEXT : TL_ENT_WHITESPACE,
+                 i, i);
+  }
+}
+
+/*
+ * PlainLengths:
+ *
+ * The lengths of a text as it is written, without shortening links or
+ * compacting emoji. Parsing gets these from the tokenizer for free.
+ */
+typedef struct {
+  gsize n_characters;
+  gsize n_utf16_units;
+  gsize length_in_weighted_characters;
+} PlainLengths;
+
+static inline void
+plain_lengths_from_tokenizer (PlainLengths    *plain,
+                              const Tokenizer *tokenizer)
+{
+  plain->n_characters = tokenizer->character_index;
+  plain->n_utf16_units = tokenizer->utf16_index;
+  plain->length_in_weighted_characters = tokenizer->plain_weighted_index;
+}
+
+/*
+ * count_plain_text:
+ * @sink: The sink to add the total length of @input to
+ * @plain: (out): Where to store the plain lengths of the tokens read
+ *
+ * Counts text that find_entity_candidate() found nothing in. Every token of
+ * such a text is an entity of its own, so this only runs the tokenizer.
+ */
+static void
+count_plain_text (EntitySink   *sink,
+                  const char   *input,
+                  gsize         length_in_bytes,
+                  PlainLengths *plain)
+{
+  guint32 byte_offsets[2];
+  guint32 character_offsets[2];
+  guint32 utf16_offsets[2];
+  guint32 weighted_offsets[2];
+  guint32 plain_weighted_offsets[2];
+  guint8 types[2];
+  guint16 classes[2];
+  Tokens token = { NULL, 0, 0, byte_offsets, character_offsets, utf16_offsets, weighted_offsets, plain_weighted_offsets,
+                   types, classes, 0, 2 };
+  Tokenizer tokenizer;
+
+  tokenizer_init (&tokenizer, input, length_in_bytes, sink->compact_emoji);
+
+  while (sink->truncation_point == NULL) {
+    tokens_start (&token, &tokenizer);
+
+    if (!tokenizer_next (&tokenizer, &token)) {
+      break;
+    }
+
+    emit_plain_tokens (sink, &token, 0, 1);
+  }
+
+  plain_lengths_from_tokenizer (plain, &tokenizer);
+}
+
+/*
+ * parse_candidates:
+ * @sink: Where to put the entities
+ * @tokens: The tokens to parse
+ * @hosts: Room for scan_hosts() results for @n_tokens tokens
+ * @n_tokens: The number of tokens in @tokens
+ * @end: Index of the first token that should not start an entity
+ * @candidate: (inout): The next '.', '@' or '#' in the input, see find_entity_candidate()
+ * @input_end: End of the input
+ *
+ * Does the same as scan_hosts() and parse_tokens(), but only for the words
+ * around @candidate and the ones after it. The rest is emitted as plain text.
+ * Like parse_input() does with its windows, this relies on nothing reaching
+ * past a whitespace token, so a word can be parsed together with the
+ * whitespace tokens around it.
+ */
+static void
+parse_candidates (EntitySink    *sink,
+                  const Tokens  *tokens,
+                  HostInfo      *hosts,
+                  gsize          n_tokens,
+                  gsize          end,
+                  const char   **candidate,
+                  const char    *input_end)
+{
+  gsize i = 0;
+
+  while (i < end && sink->truncation_point == NULL) {
+    const gsize candidate_offset = *candidate - tokens->input;
+    Tokens word;
+    gsize first, last;
+
+    if (*candidate == input_end || candidate_offset >= tokens->byte_offsets[end]) {
+      emit_plain_tokens (sink, tokens, i, end);
+      return;
+    }
+
+    // Find the token the candidate is in, and the whitespace before and after it
+    last = i;
+    while (tokens->byte_offsets[last + 1] <= candidate_offset) {
+      last ++;
+    }
+
+    first = last;
+    while (first > i && tokens->types[first] != TOK_WHITESPACE) {
+      first --;
+    }
+
+    while (last < end && tokens->types[last] != TOK_WHITESPACE) {
+      last ++;
     }
 
-    emplace_entity_for_tokens (entities,
-                               tokens,
-                               token->type == TOK_TEXT ? TL_ENT_TEXT : TL_ENT_WHITESPACE,
-                               i, i);
+    emit_plain_tokens (sink, tokens, i, first);
 
-    i ++;
+    if (sink->truncation_point != NULL) {
+      return;
+    }
+
+    word = *tokens;
+    word.byte_offsets += first;
+    word.character_offsets += first;
+    word.utf16_offsets += first;
+    word.weighted_offsets += first;
+    word.plain_weighted_offsets += first;
+    word.types += first;
+    word.classes += first;
+    word.len = MIN (last + 1, n_tokens) - first;
+
+    scan_hosts (&word, word.len, hosts);
+    parse_tokens (sink, &word, hosts, word.len, last - first);
+
+    i = last;
+    *candidate = find_entity_candidate (token_start (tokens, last), input_end);
+  }
+}
+
+/*
+ * parse_input_plain:
+ * @context: Context to grow the window in, if it has to
+ * @sink: Where to put the entities
+ * @plain: (out): Where to store the lengths of @input without shortening
+ *   links or compacting emoji. Only complete if the limit of @sink was not crossed.
+ *
+ * Runs the tokenizer and the parse functions over @input together, keeping
+ * only a window of COUNT_WINDOW_SIZE tokens on the stack instead of all of
+ * them. No entity (and no lookahead of the parse functions) reaches past a
+ * whitespace token, so everything before the last whitespace token in the
+ * window can be parsed and emitted on its own. That whitespace token is kept
+ * as the first token of the next window so mentions, hashtags and links can
+ * still look behind them.
+ *
+ * A window without any whitespace is moved to @context and grown until
+ * there is some, so memory use depends on the longest run of tokens without
+ * whitespace rather than on the length of @input.
+ *
+ * Only the words find_entity_candidate() finds something in go through the
+ * parse functions, see parse_candidates().
+ */
+static void
+parse_input_plain (TlContext    *context,
+                   EntitySink   *sink,
+                   const char   *input,
+                   gsize         length_in_bytes,
+                   PlainLengths *plain)
+{
+  guint32 byte_offsets[COUNT_WINDOW_SIZE + 1];
+  guint32 character_offsets[COUNT_WINDOW_SIZE + 1];
+  guint32 utf16_offsets[COUNT_WINDOW_SIZE + 1];
+  guint32 weighted_offsets[COUNT_WINDOW_SIZE + 1];
+  guint32 plain_weighted_offsets[COUNT_WINDOW_SIZE + 1];
+  guint8 types[COUNT_WINDOW_SIZE + 1];
+  guint16 classes[COUNT_WINDOW_SIZE + 1];
+  Tokens stack_tokens = { NULL, 0, 0, byte_offsets, character_offsets, utf16_offsets, weighted_offsets,
+                          plain_weighted_offsets, types, classes, 0, COUNT_WINDOW_SIZE + 1 };
+  HostInfo stack_hosts[COUNT_WINDOW_SIZE];
+  Tokens *tokens = &stack_tokens;
+  HostInfo *hosts = stack_hosts;
+  Tokenizer tokenizer;
+  const char *input_end = input + length_in_bytes;
+  const char *candidate = find_entity_candidate (input, input_end);
+
+  if (candidate == input_end) {
+    count_plain_text (sink, input, length_in_bytes, plain);
+    return;
+  }
+
+  tokenizer_init (&tokenizer, input, length_in_bytes, sink->compact_emoji);
+  tokens_start (tokens, &tokenizer);
+
+  for (;;) {
+    // tokenizer_next() needs room for one more entry than the tokens it adds
+    const gsize window_size = tokens->allocated - 1;
+    gsize last_whitespace;
+
+    while (tokens->len < window_size) {
+      if (!tokenizer_next (&tokenizer, tokens)) {
+        break;
+      }
+    }
+
+    if (tokens->len < window_size) {
+      // Reached the end of the input
+      parse_candidates (sink, tokens, hosts, tokens->len, tokens->len, &candidate, input_end);
+      plain_lengths_from_tokenizer (plain, &tokenizer);
+      return;
+    }
+
+    last_whitespace = tokens->len - 1;
+    while (last_whitespace > 0 && tokens->types[last_whitespace] != TOK_WHITESPACE) {
+      last_whitespace --;
+    }
+
+    if (last_whitespace == 0) {
+      // A whole window without whitespace, which nothing that fits in a tweet has.
+      // Keep going in a bigger one.
+      GArray *host_array;
+
+      if (tokens == &stack_tokens) {
+        tokens = &context->tokens;
+        tokens_copy (tokens, &stack_tokens);
+      }
+
+      tokens_reserve (tokens, tokens->len * 2);
+      host_array = context_array (&context->hosts, sizeof (HostInfo));
+      g_array_set_size (host_array, tokens->allocated);
+      hosts = (HostInfo *)host_array->data;
+      continue;
+    }
+
+    parse_candidates (sink, tokens, hosts, last_whitespace + 1, last_whitespace, &candidate, input_end);
+
+    if (sink->truncation_point != NULL) {
+      plain_lengths_from_tokenizer (plain, &tokenizer);
+      return;
+    }
+
+    tokens_drop (tokens, last_whitespace);
+  }
+}
+
+/*
+ * parse_input:
+ *
+ * Like parse_input_plain(), for callers that only need the plain weighted length.
+ *
+ * Returns: The weighted length of @input without shortening links or
+ *   compacting emoji. Only complete if the limit of @sink was not crossed.
+ */
+static gsize
+parse_input (TlContext  *context,
+             EntitySink *sink,
+             const char *input,
+             gsize       length_in_bytes)
+{
+  PlainLengths plain;
+
+  parse_input_plain (context, sink, input, length_in_bytes, &plain);
+
+  return plain.length_in_weighted_characters;
+}
+
+/**
+ * tl_context_new:
+ *
+ * Creates a context holding scratch memory for the *_ctx functions. Using
+ * the same context for many calls saves allocating that memory on every call.
+ * A context may only be used by one thread at a time.
+ *
+ * Returns: (transfer full): A new #TlContext, free it with tl_context_free()
+ */
+TlContext *
+tl_context_new (void)
+{
+  return g_new0 (TlContext, 1);
+}
+
+/**
+ * tl_context_free:
+ * @context: (nullable): The context to free
+ */
+void
+tl_context_free (TlContext *context)
+{
+  if (context == NULL) {
+    return;
+  }
+
+  context_clear (context);
+  g_free (context);
+}
+
+/*
+ * tl_count_chars:
+ * input: (nullable): NUL-terminated tweet text
+ *
+ * Returns: The length of @input, in characters.
+ */
+gsize
+tl_count_characters (const char *input)
+{
+  if (input == NULL || input[0] == '\0') {
+    return 0;
+  }
+
+  return tl_count_characters_n (input, strlen (input));
+}
+
+/*
+ * tl_count_characters_ctx:
+ *
+ * Like tl_count_characters(), using the scratch memory of @context.
+ */
+gsize
+tl_count_characters_ctx (TlContext  *context,
+                         const char *input)
+{
+  if (input == NULL || input[0] == '\0') {
+    return 0;
+  }
+
+  return tl_count_characters_n_ctx (context, input, strlen (input));
+}
+
+/*
+ * tl_count_characters_n:
+ * input: (nullable): Text to measure
+ * length_in_bytes: Length of @input, in bytes.
+ *
+ * Returns: The length of @input, in characters.
+ */
+gsize
+tl_count_characters_n (const char *input,
+                       gsize       length_in_bytes)
+{
+  TlContext context = { 0, };
+  gsize length = tl_count_characters_n_ctx (&context, input, length_in_bytes);
+
+  context_clear (&context);
+
+  return length;
+}
+
+/*
+ * tl_count_characters_n_ctx:
+ *
+ * Like tl_count_characters_n(), using the scratch memory of @context.
+ */
+gsize
+tl_count_characters_n_ctx (TlContext  *context,
+                           const char *input,
+                           gsize       length_in_bytes)
+{
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, FALSE, NULL, 0, NULL, NULL, FALSE, NULL };
+
+  g_return_val_if_fail (context != NULL, 0);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, 0);
+
+  if (input == NULL || input[0] == '\0') {
+    return 0;
+  }
+
+  // From here on, input/length_in_bytes are trusted to be OK
+  parse_input (context, &sink, input, length_in_bytes);
+
+  return sink.length_in_characters;
+}
+
+/*
+ * count_weighted_characters:
+ *
+ * Adds the weighted length of @input to @sink, without normalizing it.
+ * Stops early once the limit of @sink has been crossed.
+ */
+static void
+count_weighted_characters (TlContext  *context,
+                           EntitySink *sink,
+                           const char *input,
+                           gsize       length_in_bytes,
+                           guint       count_mode)
+{
+  const gsize start_weight = sink->length_in_weighted_characters;
+  const char *p = input;
+
+  if (count_mode == COUNT_SHORT_URLS || count_mode == COUNT_COMPACT) {
+    parse_input (context, sink, input, length_in_bytes);
+    return;
+  }
+
+  while (p - input < (long)length_in_bytes) {
+    sink->length_in_weighted_characters += is_weighted_character (g_utf8_get_char (p)) ? WEIGHTED_VALUE : UNWEIGHTED_VALUE;
+
+    if (sink->length_in_weighted_characters > sink->limit) {
+      sink->truncation_point = input + truncate_chars (input, length_in_bytes, FALSE, sink->limit - start_weight);
+      return;
+    }
+
+    p = g_utf8_next_char (p);
+  }
+}
+
+/*
+ * nfc_quick_check:
+ *
+ * The NFC_Quick_Check algorithm from UAX #15, without the canonical ordering
+ * check. Reordering combining marks never changes how long a text is, so
+ * only code points that can change on composition matter here.
+ *
+ * Returns: %TRUE if @input is known to be in NFC already
+ */
+static gboolean
+nfc_quick_check (const char *input,
+                 gsize       length_in_bytes)
+{
+  const guchar *p = (const guchar *)input;
+  const guchar *end = p + length_in_bytes;
+
+  while (p < end) {
+    // Everything below U+0300 (lead byte 0xCC) is NFC_QC=Yes
+    if (*p < 0xCC) {
+      p ++;
+      continue;
+    }
+
+    if (char_properties (g_utf8_get_char ((const char *)p)) & (CHAR_PROPS_NFC_NO | CHAR_PROPS_NFC_MAYBE)) {
+      return FALSE;
+    }
+
+    p = (const guchar *)g_utf8_next_char (p);
+  }
+
+  return TRUE;
+}
+
+/*
+ * count_weighted_characters_normalized:
+ *
+ * Counts @input as if it had been put in NFC first. Whitespace never composes with
+ * anything and no entity reaches past it, so the text between two whitespace
+ * characters can be normalized and counted on its own. Only the parts that fail
+ * the quick check get normalized, everything else is counted in place. Words that
+ * had to be normalized are never truncated in the middle.
+ */
+static void
+count_weighted_characters_normalized (TlContext  *context,
+                                      EntitySink *sink,
+                                      const char *input,
+                                      gsize       length_in_bytes,
+                                      guint       count_mode)
+{
+  const char *end = input + length_in_bytes;
+  const char *p = input;
+  // Start of the text that has not been counted yet, and of the current word
+  const char *span_start = input;
+  const char *word_start = input;
+  gboolean word_is_nfc = TRUE;
+
+  if (nfc_quick_check (input, length_in_bytes)) {
+    count_weighted_characters (context, sink, input, length_in_bytes, count_mode);
+    return;
+  }
+
+  while (p < end) {
+    const guint props = char_properties (g_utf8_get_char (p));
+    const char *next = MIN (g_utf8_next_char (p), end);
+
+    if (props & (CHAR_PROPS_NFC_NO | CHAR_PROPS_NFC_MAYBE)) {
+      word_is_nfc = FALSE;
+    }
+
+    if (CHAR_PROPS_TOKEN_TYPE (props) == TOK_WHITESPACE || next == end) {
+      if (!word_is_nfc) {
+        EntitySink word_sink = { NULL, 0, 0, G_MAXSIZE, sink->compact_emoji, NULL, 0, NULL, NULL, FALSE, NULL };
+        char *normalized = g_utf8_normalize (word_start, next - word_start, G_NORMALIZE_DEFAULT_COMPOSE);
+
+        count_weighted_characters (context, sink, span_start, word_start - span_start, count_mode);
+        if (sink->truncation_point != NULL) {
+          return;
+        }
+
+        if (normalized != NULL) {
+          count_weighted_characters (context, &word_sink, normalized, strlen (normalized), count_mode);
+          g_free (normalized);
+        } else {
+          // Invalid UTF-8 can't be normalized
+          count_weighted_characters (context, &word_sink, word_start, next - word_start, count_mode);
+        }
+
+        if (sink->length_in_weighted_characters + word_sink.length_in_weighted_characters > sink->limit) {
+          sink->truncation_point = word_start;
+        }
+        sink->length_in_characters += word_sink.length_in_characters;
+        sink->length_in_weighted_characters += word_sink.length_in_weighted_characters;
+        if (sink->truncation_point != NULL) {
+          return;
+        }
+
+        span_start = next;
+      }
+
+      word_start = next;
+      word_is_nfc = TRUE;
+    }
+
+    p = next;
+  }
+
+  count_weighted_characters (context, sink, span_start, end - span_start, count_mode);
+}
+
+/*
+ * normalize_weighted_length:
+ * @length_in_weighted_characters: The weighted length of @input as it is,
+ *   counted with @count_mode
+ *
+ * Corrects a weighted length that was counted without normalizing @input,
+ * like count_weighted_characters_normalized() would have counted it. Only the
+ * words that fail the quick check are counted again, before and after
+ * normalizing them.
+ *
+ * Returns: The weighted length of @input in NFC
+ */
+static gsize
+normalize_weighted_length (TlContext  *context,
+                           const char *input,
+                           gsize       length_in_bytes,
+                           guint       count_mode,
+                           gsize       length_in_weighted_characters)
+{
+  const char *end = input + length_in_bytes;
+  const char *p = input;
+  const char *word_start = input;
+  gboolean word_is_nfc = TRUE;
+
+  if (nfc_quick_check (input, length_in_bytes)) {
+    return length_in_weighted_characters;
   }
 
-  if (n_relevant_entities) {
-    *n_relevant_entities = relevant_entities;
+  while (p < end) {
+    const guint props = char_properties (g_utf8_get_char (p));
+    const char *next = MIN (g_utf8_next_char (p), end);
+
+    if (props & (CHAR_PROPS_NFC_NO | CHAR_PROPS_NFC_MAYBE)) {
+      word_is_nfc = FALSE;
+    }
+
+    if (CHAR_PROPS_TOKEN_TYPE (props) == TOK_WHITESPACE || next == end) {
+      char *normalized = NULL;
+
+      if (!word_is_nfc) {
+        normalized = g_utf8_normalize (word_start, next - word_start, G_NORMALIZE_DEFAULT_COMPOSE);
+      }
+
+      // Invalid UTF-8 can't be normalized, it stays counted as it is
+      if (normalized != NULL) {
+        EntitySink word_sink = { NULL, 0, 0, G_MAXSIZE, count_mode == COUNT_COMPACT, NULL, 0, NULL, NULL,
+                                 FALSE, NULL };
+        EntitySink normalized_sink = { NULL, 0, 0, G_MAXSIZE, count_mode == COUNT_COMPACT, NULL, 0, NULL, NULL,
+                                       FALSE, NULL };
+
+        count_weighted_characters (context, &word_sink, word_start, next - word_start, count_mode);
+        count_weighted_characters (context, &normalized_sink, normalized, strlen (normalized), count_mode);
+        length_in_weighted_characters -= word_sink.length_in_weighted_characters;
+        length_in_weighted_characters += normalized_sink.length_in_weighted_characters;
+        g_free (normalized);
+      }
+
+      word_start = next;
+      word_is_nfc = TRUE;
+    }
+
+    p = next;
+  }
+
+  return length_in_weighted_characters;
+}
+
+/*
+ * tl_count_weighted_chararacters:
+ * input: (nullable): NUL-terminated tweet text
+ * count_mode: COUNT_BASIC to do a dumb weighting count,
+ *    COUNT_SHORT_URLS to do dumb weighting count but with URLs only counting as short url
+ *    or COUNT_COMPACT for full short URL and compact emoji behaviour
+ *
+ * @input is counted as if it was in Unicode Normalization Form C.
+ *
+ * Returns: The length of @input, in Twitter's weighted characters.
+ */
+gsize
+tl_count_weighted_characters (const char *input, guint count_mode)
+{
+  TlContext context = { 0, };
+  gsize length = tl_count_weighted_characters_ctx (&context, input, count_mode);
+
+  context_clear (&context);
+
+  return length;
+}
+
+/*
+ * tl_count_weighted_characters_ctx:
+ *
+ * Like tl_count_weighted_characters(), using the scratch memory of @context.
+ */
+gsize
+tl_count_weighted_characters_ctx (TlContext  *context,
+                                  const char *input,
+                                  guint       count_mode)
+{
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, count_mode == COUNT_COMPACT, NULL, 0, NULL, NULL, FALSE, NULL };
+  gsize length_in_bytes;
+
+  g_return_val_if_fail (context != NULL, 0);
+
+  if (input == NULL || input[0] == '\0') {
+    return 0;
+  }
+
+  length_in_bytes = strlen (input);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, 0);
+
+  count_weighted_characters_normalized (context, &sink, input, length_in_bytes, count_mode);
+
+  return sink.length_in_weighted_characters;
+}
+
+/*
+ * tl_count_weighted_characters_n:
+ * input: (nullable): Text to measure
+ * length_in_bytes: Length of @input, in bytes.
+ * compact_emoji: whether to count joined emoji as a compacted single character
+ *
+ * @input is counted as if it was in Unicode Normalization Form C.
+ *
+ * Returns: The length of @input, in characters.
+ */
+gsize
+tl_count_weighted_characters_n (const char *input,
+                                gsize       length_in_bytes,
+                                gboolean    compact_emoji)
+{
+  TlContext context = { 0, };
+  gsize length = tl_count_weighted_characters_n_ctx (&context, input, length_in_bytes, compact_emoji);
+
+  context_clear (&context);
+
+  return length;
+}
+
+/*
+ * tl_count_weighted_characters_n_ctx:
+ *
+ * Like tl_count_weighted_characters_n(), using the scratch memory of @context.
+ */
+gsize
+tl_count_weighted_characters_n_ctx (TlContext  *context,
+                                    const char *input,
+                                    gsize       length_in_bytes,
+                                    gboolean    compact_emoji)
+{
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, compact_emoji, NULL, 0, NULL, NULL, FALSE, NULL };
+
+  g_return_val_if_fail (context != NULL, 0);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, 0);
+
+  if (input == NULL || input[0] == '\0') {
+    return 0;
+  }
+
+  // From here on, input/length_in_bytes are trusted to be OK
+  count_weighted_characters_normalized (context,
+                                        &sink,
+                                        input,
+                                        length_in_bytes,
+                                        compact_emoji ? COUNT_COMPACT : COUNT_SHORT_URLS);
+
+  return sink.length_in_weighted_characters;
+}
+
+/*
+ * LinkWeights:
+ *
+ * What count_all() needs to know about the links in a text to get from its
+ * weighted length without shortening links to the one with.
+ */
+typedef struct {
+  gsize n_links;
+  // Weighted length of the links as they are written
+  gsize length_in_weighted_characters;
+} LinkWeights;
+
+static void
+add_link_weight (const TlEntity *entity,
+                 gpointer        user_data)
+{
+  LinkWeights *links = user_data;
+
+  links->n_links ++;
+  links->length_in_weighted_characters += entity->length_in_weighted_characters;
+}
+
+/*
+ * count_all:
+ * @out: Where to store the lengths of @input
+ *
+ * Parses @input once with compact emoji. That gives the compact length
+ * directly, and parse_input() returns the length without shortening links or
+ * compacting emoji, which is the basic one. The short URL one is that with
+ * every link replaced by LINK_LENGTH.
+ */
+static void
+count_all (TlContext  *context,
+           const char *input,
+           gsize       length_in_bytes,
+           TlCounts   *out)
+{
+  LinkWeights links = { 0, 0 };
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, TRUE, NULL, TL_ENTITY_MASK_LINK, add_link_weight, &links, TRUE, NULL };
+  gsize length_in_weighted_characters;
+
+  length_in_weighted_characters = parse_input (context, &sink, input, length_in_bytes);
+
+  out->characters = sink.length_in_characters;
+  out->weighted_basic = length_in_weighted_characters;
+  out->weighted_short_urls = length_in_weighted_characters - links.length_in_weighted_characters +
+                             links.n_links * LINK_LENGTH;
+  out->weighted_compact = sink.length_in_weighted_characters;
+}
+
+/**
+ * tl_count_all:
+ * @input: (nullable): Text to measure
+ * @length_in_bytes: Length of @input, in bytes
+ * @out: (out caller-allocates): Where to store the lengths of @input
+ *
+ * Fills @out with what tl_count_characters_n() and
+ * tl_count_weighted_characters() for all three count modes would return for
+ * @input, reading it only once instead of four times.
+ */
+void
+tl_count_all (const char *input,
+              gsize       length_in_bytes,
+              TlCounts   *out)
+{
+  TlContext context = { 0, };
+
+  tl_count_all_ctx (&context, input, length_in_bytes, out);
+
+  context_clear (&context);
+}
+
+/*
+ * tl_count_all_ctx:
+ *
+ * Like tl_count_all(), using the scratch memory of @context.
+ */
+void
+tl_count_all_ctx (TlContext  *context,
+                  const char *input,
+                  gsize       length_in_bytes,
+                  TlCounts   *out)
+{
+  char *normalized;
+
+  g_return_if_fail (context != NULL);
+  g_return_if_fail (out != NULL);
+  g_return_if_fail (length_in_bytes <= G_MAXUINT32);
+
+  memset (out, 0, sizeof (TlCounts));
+
+  if (input == NULL || input[0] == '\0') {
+    return;
+  }
+
+  // From here on, input/length_in_bytes are trusted to be OK
+  if (nfc_quick_check (input, length_in_bytes)) {
+    count_all (context, input, length_in_bytes, out);
+    return;
+  }
+
+  // The weighted lengths are of the normalized text, but the character count
+  // is of @input as it is, see count_weighted_characters_normalized()
+  normalized = g_utf8_normalize (input, length_in_bytes, G_NORMALIZE_DEFAULT_COMPOSE);
+  if (normalized != NULL) {
+    count_all (context, normalized, strlen (normalized), out);
+    g_free (normalized);
+  } else {
+    // Invalid UTF-8 can't be normalized
+    count_all (context, input, length_in_bytes, out);
+  }
+
+  out->characters = tl_count_characters_n_ctx (context, input, length_in_bytes);
+}
+
+/**
+ * tl_fits_within:
+ * @input: (nullable): Text to measure
+ * @length_in_bytes: Length of @input, in bytes
+ * @limit: The maximum weighted length
+ * @count_mode: How to count @input, see tl_count_weighted_characters()
+ *
+ * Checks whether @input is at most @limit weighted characters long. This stops
+ * as soon as the limit has been crossed, so it is cheaper than counting all
+ * of a long text.
+ *
+ * Returns: %TRUE if tl_count_weighted_characters() would return at most @limit for @input
+ */
+gboolean
+tl_fits_within (const char *input,
+                gsize       length_in_bytes,
+                gsize       limit,
+                guint       count_mode)
+{
+  TlContext context = { 0, };
+  gboolean fits = tl_fits_within_ctx (&context, input, length_in_bytes, limit, count_mode);
+
+  context_clear (&context);
+
+  return fits;
+}
+
+/**
+ * tl_fits_within_ctx:
+ *
+ * Like tl_fits_within(), using the scratch memory of @context.
+ */
+gboolean
+tl_fits_within_ctx (TlContext  *context,
+                    const char *input,
+                    gsize       length_in_bytes,
+                    gsize       limit,
+                    guint       count_mode)
+{
+  EntitySink sink = { NULL, 0, 0, limit, count_mode == COUNT_COMPACT, NULL, 0, NULL, NULL, FALSE, NULL };
+
+  g_return_val_if_fail (context != NULL, FALSE);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, FALSE);
+
+  if (input == NULL || input[0] == '\0') {
+    return TRUE;
+  }
+
+  // No character weighs more than two and each takes at least one byte. The shortest
+  // links (like "a.co") take four bytes and count as LINK_LENGTH.
+  if (count_mode == COUNT_BASIC ? length_in_bytes * WEIGHTED_VALUE <= limit
+                                : length_in_bytes * LINK_LENGTH <= limit * MIN_LINK_LENGTH_IN_BYTES) {
+    return TRUE;
+  }
+
+  count_weighted_characters_normalized (context, &sink, input, length_in_bytes, count_mode);
+
+  return sink.truncation_point == NULL;
+}
+
+/**
+ * tl_find_truncation_offset:
+ * @input: (nullable): Text to truncate
+ * @length_in_bytes: Length of @input, in bytes
+ * @limit: The maximum weighted length
+ * @count_mode: How to count @input, see tl_count_weighted_characters()
+ *
+ * Finds where @input has to be cut so it is at most @limit weighted characters
+ * long. Links, mentions, hashtags and emoji sequences are never cut in half,
+ * so the result may be shorter than @limit.
+ *
+ * Returns: The length of the longest prefix of @input that fits in @limit, in bytes.
+ *   This is @length_in_bytes if all of @input fits.
+ */
+gsize
+tl_find_truncation_offset (const char *input,
+                           gsize       length_in_bytes,
+                           gsize       limit,
+                           guint       count_mode)
+{
+  TlContext context = { 0, };
+  gsize offset = tl_find_truncation_offset_ctx (&context, input, length_in_bytes, limit, count_mode);
+
+  context_clear (&context);
+
+  return offset;
+}
+
+/**
+ * tl_find_truncation_offset_ctx:
+ *
+ * Like tl_find_truncation_offset(), using the scratch memory of @context.
+ */
+gsize
+tl_find_truncation_offset_ctx (TlContext  *context,
+                               const char *input,
+                               gsize       length_in_bytes,
+                               gsize       limit,
+                               guint       count_mode)
+{
+  EntitySink sink = { NULL, 0, 0, limit, count_mode == COUNT_COMPACT, NULL, 0, NULL, NULL, FALSE, NULL };
+
+  g_return_val_if_fail (context != NULL, 0);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, 0);
+
+  if (input == NULL || input[0] == '\0') {
+    return 0;
+  }
+
+  count_weighted_characters_normalized (context, &sink, input, length_in_bytes, count_mode);
+
+  // What follows a link decides whether it is one ("ab.cd@x" isn't, "ab.cd" is),
+  // so the prefix might not fit on its own. In that case cut it again.
+  while (sink.truncation_point != NULL) {
+    const gsize prefix_length = sink.truncation_point - input;
+
+    sink.length_in_characters = 0;
+    sink.length_in_weighted_characters = 0;
+    sink.truncation_point = NULL;
+    count_weighted_characters_normalized (context, &sink, input, prefix_length, count_mode);
+
+    if (sink.truncation_point == NULL) {
+      return prefix_length;
+    }
+  }
+
+  return length_in_bytes;
+}
+
+static const TlEntity *
+extract_entities (TlContext  *context,
+                  const char *input,
+                  gsize       length_in_bytes,
+                  gsize      *out_n_entities,
+                  gsize      *out_text_length,
+                  gboolean    extract_text_entities)
+{
+  EntitySink sink = { context_array (&context->entities, sizeof (TlEntity)), 0, 0, G_MAXSIZE, FALSE, NULL,
+                      extract_mask (extract_text_entities ? TL_EXTRACT_TEXT : 0), NULL, NULL, FALSE, NULL };
+  GArray *entities = sink.entities;
+
+  parse_input (context, &sink, input, length_in_bytes);
+
+#ifdef LIBTL_DEBUG
+  g_debug ("############ %s: %.*s", __FUNCTION__, (guint)length_in_bytes, input);
+  for (guint i = 0; i < entities->len; i ++) {
+    const TlEntity *e = &g_array_index (entities, TlEntity, i);
+    g_debug ("TlEntity %u: Text: '%.*s', Type: %u, Bytes: %u, Length: %u, start character: %u", i, (int)e->length_in_bytes, e->start,
+               e->type, (guint)e->length_in_bytes, (guint)entity_length_in_characters (e), (guint)e->start_character_index);
+  }
+#endif
+
+  *out_text_length = sink.length_in_characters;
+  *out_n_entities = entities->len;
+
+  return entities->len > 0 ? (const TlEntity *)entities->data : NULL;
+}
+
+/*
+ * steal_entities:
+ * @context: A temporary context
+ * @entities: The result of extract_entities() with @context
+ *
+ * Frees @context, except for @entities
+ *
+ * Returns: (transfer full): @entities
+ */
+static TlEntity *
+steal_entities (TlContext      *context,
+                const TlEntity *entities)
+{
+  TlEntity *result = NULL;
+
+  if (entities != NULL) {
+    result = (TlEntity *)g_array_free (context->entities, FALSE);
+    context->entities = NULL;
+  }
+
+  context_clear (context);
+
+  return result;
+}
+
+/**
+ * tl_extract_entities:
+ * @input: The input text to extract entities from
+ * @out_n_entities: (out): Location to store the amount of entities in the returned
+ *   array. If 0, the return value is %NULL.
+ * @out_text_length: (out) (optional): Return location for the complete
+ *   length of @input, in characters. This is the same value one would
+ *   get from calling tl_count_characters() or tl_count_characters_n()
+ *   on @input.
+ *
+ * Returns: An array of #TlEntity. If no entities are found, %NULL is returned.
+ */
+TlEntity *
+tl_extract_entities (const char *input,
+                     gsize      *out_n_entities,
+                     gsize      *out_text_length)
+{
+  TlContext context = { 0, };
+
+  return steal_entities (&context, tl_extract_entities_ctx (&context, input, out_n_entities, out_text_length));
+}
+
+/**
+ * tl_extract_entities_ctx:
+ *
+ * Like tl_extract_entities(), using the scratch memory of @context.
+ *
+ * Returns: (transfer none): An array of #TlEntity, owned by @context and valid until
+ *   it is used again. If no entities are found, %NULL is returned.
+ */
+const TlEntity *
+tl_extract_entities_ctx (TlContext  *context,
+                         const char *input,
+                         gsize      *out_n_entities,
+                         gsize      *out_text_length)
+{
+  gsize dummy;
+
+  g_return_val_if_fail (context != NULL, NULL);
+  g_return_val_if_fail (out_n_entities != NULL, NULL);
+
+  if (out_text_length == NULL) {
+    out_text_length = &dummy;
+  }
+
+  if (input == NULL || input[0] == '\0') {
+    *out_n_entities = 0;
+    *out_text_length = 0;
+    return NULL;
+  }
+
+  return tl_extract_entities_n_ctx (context, input, strlen (input), out_n_entities, out_text_length);
+}
+
+/**
+ * tl_extract_entities_n:
+ * @input: The input text to extract entities from
+ * @length_in_bytes: The length of @input, in bytes
+ * @out_n_entities: (out): Location to store the amount of entities in the returned
+ *   array. If 0, the return value is %NULL.
+ * @out_text_length: (out) (optional): Return location for the complete
+ *   length of @input, in characters. This is the same value one would
+ *   get from calling tl_count_characters() or tl_count_characters_n()
+ *   on @input.
+ *
+ * Returns: An array of #TlEntity. If no entities are found, %NULL is returned.
+ */
+TlEntity *
+tl_extract_entities_n (const char *input,
+                       gsize       length_in_bytes,
+                       gsize      *out_n_entities,
+                       gsize      *out_text_length)
+{
+  TlContext context = { 0, };
+
+  return steal_entities (&context, tl_extract_entities_n_ctx (&context, input, length_in_bytes, out_n_entities, out_text_length));
+}
+
+/**
+ * tl_extract_entities_n_ctx:
+ *
+ * Like tl_extract_entities_n(), using the scratch memory of @context.
+ *
+ * Returns: (transfer none): An array of #TlEntity, owned by @context and valid until
+ *   it is used again. If no entities are found, %NULL is returned.
+ */
+const TlEntity *
+tl_extract_entities_n_ctx (TlContext  *context,
+                           const char *input,
+                           gsize       length_in_bytes,
+                           gsize      *out_n_entities,
+                           gsize      *out_text_length)
+{
+  gsize dummy;
+
+  g_return_val_if_fail (context != NULL, NULL);
+  g_return_val_if_fail (out_n_entities != NULL, NULL);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, NULL);
+
+  if (out_text_length == NULL) {
+    out_text_length = &dummy;
+  }
+
+  if (input == NULL || input[0] == '\0') {
+    *out_n_entities = 0;
+    *out_text_length = 0;
+    return NULL;
+  }
+
+  return extract_entities (context,
+                           input,
+                           length_in_bytes,
+                           out_n_entities,
+                           out_text_length,
+                           FALSE);
+}
+
+/**
+ * tl_extract_entities_and_text:
+ * @input: The input text to extract entities from
+ * @out_n_entities: (out): Location to store the amount of entities in the returned
+ *   array. If 0, the return value is %NULL.
+ * @out_text_length: (out) (optional): Return location for the complete
+ *   length of @input, in characters. This is the same value one would
+ *   get from calling tl_count_characters() or tl_count_characters_n()
+ *   on @input.
+ *
+ * This is different from tl_extract_entities() in that it returns all entities
+ * and not just hashtags, links and mentions. This allows for further post-processing
+ * from the caller.
+ *
+ * Returns: An array of #TlEntity. If no entities are found, %NULL is returned.
+ */
+TlEntity *
+tl_extract_entities_and_text (const char *input,
+                              gsize      *out_n_entities,
+                              gsize      *out_text_length)
+{
+  TlContext context = { 0, };
+
+  return steal_entities (&context, tl_extract_entities_and_text_ctx (&context, input, out_n_entities, out_text_length));
+}
+
+/**
+ * tl_extract_entities_and_text_ctx:
+ *
+ * Like tl_extract_entities_and_text(), using the scratch memory of @context.
+ *
+ * Returns: (transfer none): An array of #TlEntity, owned by @context and valid until
+ *   it is used again. If no entities are found, %NULL is returned.
+ */
+const TlEntity *
+tl_extract_entities_and_text_ctx (TlContext  *context,
+                                  const char *input,
+                                  gsize      *out_n_entities,
+                                  gsize      *out_text_length)
+{
+  gsize dummy;
+
+  g_return_val_if_fail (context != NULL, NULL);
+  g_return_val_if_fail (out_n_entities != NULL, NULL);
+
+  if (out_text_length == NULL) {
+    out_text_length = &dummy;
+  }
+
+  if (input == NULL || input[0] == '\0') {
+    *out_n_entities = 0;
+    *out_text_length = 0;
+    return NULL;
+  }
+
+  return tl_extract_entities_and_text_n_ctx (context, input, strlen (input), out_n_entities, out_text_length);
+}
+
+/**
+ * tl_extract_entities_and_text_n:
+ * @input: The input text to extract entities from
+ * @length_in_bytes: The length of @input, in bytes
+ * @out_n_entities: (out): Location to store the amount of entities in the returned
+ *   array. If 0, the return value is %NULL.
+ * @out_text_length: (out) (optional): Return location for the complete
+ *   length of @input, in characters. This is the same value one would
+ *   get from calling tl_count_characters() or tl_count_characters_n()
+ *   on @input.
+ *
+ * This is different from tl_extract_entities_n() in that it returns all entities
+ * and not just hashtags, links and mentions. This allows for further post-processing
+ * from the caller.
+ *
+ * Returns: An array of #TlEntity. If no entities are found, %NULL is returned.
+ */
+TlEntity *
+tl_extract_entities_and_text_n (const char *input,
+                                gsize       length_in_bytes,
+                                gsize      *out_n_entities,
+                                gsize      *out_text_length)
+{
+  TlContext context = { 0, };
+
+  return steal_entities (&context, tl_extract_entities_and_text_n_ctx (&context, input, length_in_bytes, out_n_entities, out_text_length));
+}
+
+/**
+ * tl_extract_entities_and_text_n_ctx:
+ *
+ * Like tl_extract_entities_and_text_n(), using the scratch memory of @context.
+ *
+ * Returns: (transfer none): An array of #TlEntity, owned by @context and valid until
+ *   it is used again. If no entities are found, %NULL is returned.
+ */
+const TlEntity *
+tl_extract_entities_and_text_n_ctx (TlContext  *context,
+                                    const char *input,
+                                    gsize       length_in_bytes,
+                                    gsize      *out_n_entities,
+                                    gsize      *out_text_length)
+{
+  gsize dummy;
+
+  g_return_val_if_fail (context != NULL, NULL);
+  g_return_val_if_fail (out_n_entities != NULL, NULL);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, NULL);
+
+  if (out_text_length == NULL) {
+    out_text_length = &dummy;
+  }
+
+  if (input == NULL || input[0] == '\0') {
+    *out_n_entities = 0;
+    *out_text_length = 0;
+    return NULL;
+  }
+
+  return extract_entities (context,
+                           input,
+                           length_in_bytes,
+                           out_n_entities,
+                           out_text_length,
+                           TRUE);
+}
+
+/*
+ * A stream keeps the bytes after the last point it could cut the text at in
+ * @pending. Nothing the parse functions look at reaches past whitespace, and
+ * the weighted count functions normalize one word at a time, so the text up
+ * to any whitespace can be handled on its own and just be added up.
+ */
+struct _TlStream {
+  TlContext context;
+  TlCountType count_mode;
+  guint entity_mask;
+  TlEntityFunc entity_func;
+  gpointer user_data;
+  GString *pending;
+  gsize length_in_characters;
+  gsize length_in_weighted_characters;
+  // Characters handled so far, without counting links as LINK_LENGTH
+  gsize character_index;
+  gsize utf16_index;
+  gboolean finished;
+};
+
+static inline gboolean
+is_ascii_whitespace (char c)
+{
+  return (guchar)c < 0x80 && token_type_from_char ((guchar)c) == TOK_WHITESPACE;
+}
+
+/*
+ * stream_cut_at:
+ * @before: The byte before @p, or 0 if there is none
+ *
+ * Returns: Whether the stream can cut the text right before @p, which is
+ *   the case if @p starts a word. Cutting between two whitespace bytes
+ *   would be fine as well, but there is no need to.
+ */
+static inline gboolean
+stream_cut_at (char        before,
+               const char *p)
+{
+  return is_ascii_whitespace (before) && !is_ascii_whitespace (*p);
+}
+
+/*
+ * segment_end:
+ * @p: Start of the segment, where the stream can cut the text
+ * @end: End of the text
+ * @min_length: Minimum length of the segment, in bytes
+ *
+ * Returns: The first place after @min_length bytes from @p on where the text
+ *   can be cut, see stream_cut_at(), or @end
+ */
+static inline const char *
+segment_end (const char *p,
+             const char *end,
+             gsize       min_length)
+{
+  const char *q = p + MIN (min_length, (gsize)(end - p));
+
+  while (q < end && !stream_cut_at (q[-1], q)) {
+    q ++;
+  }
+
+  return q;
+}
+
+/*
+ * SegmentCounts:
+ *
+ * What a piece of text that starts and ends where the text can be cut adds
+ * to the counts of a #TlStream or #TlEditor.
+ */
+typedef struct {
+  // Without counting links as LINK_LENGTH, for the character indices of entities
+  gsize n_characters;
+  gsize n_utf16_units;
+  gsize length_in_characters;
+  gsize length_in_weighted_characters;
+} SegmentCounts;
+
+/*
+ * count_segment:
+ * @sink: Where to put the entities of @text. It has to count emoji the way
+ *   @count_mode does.
+ * @text: Text that starts and ends where the text can be cut
+ * @count_mode: How to count the weighted length
+ * @out: Where to store the counts of @text
+ *
+ * Counts @text and extracts its entities with a single parse. The weighted
+ * length is corrected for the words that are not in NFC afterwards, see
+ * normalize_weighted_length(), the character count is of @text as it is.
+ */
+static void
+count_segment (TlContext     *context,
+               EntitySink    *sink,
+               const char    *text,
+               gsize          length_in_bytes,
+               guint          count_mode,
+               SegmentCounts *out)
+{
+  PlainLengths plain;
+  gsize length_in_weighted_characters;
+
+  g_assert (sink->compact_emoji == (count_mode == COUNT_COMPACT));
+
+  parse_input_plain (context, sink, text, length_in_bytes, &plain);
+
+  // Without compact emoji, the sink has the short URL length
+  if (count_mode == COUNT_BASIC) {
+    length_in_weighted_characters = plain.length_in_weighted_characters;
+  } else {
+    length_in_weighted_characters = sink->length_in_weighted_characters;
+  }
+
+  out->n_characters = plain.n_characters;
+  out->n_utf16_units = plain.n_utf16_units;
+  out->length_in_characters = sink->length_in_characters;
+  out->length_in_weighted_characters = normalize_weighted_length (context, text, length_in_bytes, count_mode,
+                                                                  length_in_weighted_characters);
+}
+
+static void
+stream_emit_entity (const TlEntity *entity,
+                    gpointer        user_data)
+{
+  TlStream *stream = user_data;
+  TlEntity e = *entity;
+
+  e.start_character_index += stream->character_index;
+  e.start_utf16_index += stream->utf16_index;
+  stream->entity_func (&e, stream->user_data);
+}
+
+/*
+ * stream_process:
+ * @text: Text that starts and ends where the stream can cut the text
+ */
+static void
+stream_process (TlStream   *stream,
+                const char *text,
+                gsize       length_in_bytes)
+{
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, stream->count_mode == COUNT_COMPACT, NULL,
+                      stream->entity_mask,
+                      stream->entity_func != NULL ? stream_emit_entity : NULL, stream, TRUE, NULL };
+  SegmentCounts counts;
+
+  if (length_in_bytes == 0) {
+    return;
+  }
+
+  count_segment (&stream->context, &sink, text, length_in_bytes, stream->count_mode, &counts);
+
+  stream->length_in_characters += counts.length_in_characters;
+  stream->length_in_weighted_characters += counts.length_in_weighted_characters;
+  stream->character_index += counts.n_characters;
+  stream->utf16_index += counts.n_utf16_units;
+}
+
+/**
+ * tl_stream_new:
+ * @count_mode: How to count the weighted length, see tl_count_weighted_characters()
+ * @extract_text_entities: Whether to pass text entities to @entity_func as well,
+ *   like tl_extract_entities_and_text() does
+ * @entity_func: (nullable): Function to call for every entity found
+ * @user_data: User data for @entity_func
+ *
+ * Creates a stream to count and extract entities from text that arrives in
+ * pieces, without putting it together first. Feed it with tl_stream_feed() and
+ * end it with tl_stream_finish().
+ *
+ * @entity_func is called with the entities in order, as soon as they are
+ * decided. Their start_character_index is relative to the start of the stream,
+ * and their start pointer is only valid during the call.
+ *
+ * Returns: (transfer full): A new #TlStream, free it with tl_stream_free()
+ */
+TlStream *
+tl_stream_new (TlCountType  count_mode,
+               gboolean     extract_text_entities,
+               TlEntityFunc entity_func,
+               gpointer     user_data)
+{
+  TlStream *stream = g_new0 (TlStream, 1);
+
+  stream->count_mode = count_mode;
+  stream->entity_mask = extract_mask (extract_text_entities ? TL_EXTRACT_TEXT : 0);
+  stream->entity_func = entity_func;
+  stream->user_data = user_data;
+  stream->pending = g_string_new (NULL);
+
+  return stream;
+}
+
+/**
+ * tl_stream_free:
+ * @stream: (nullable): The stream to free
+ */
+void
+tl_stream_free (TlStream *stream)
+{
+  if (stream == NULL) {
+    return;
+  }
+
+  context_clear (&stream->context);
+  g_string_free (stream->pending, TRUE);
+  g_free (stream);
+}
+
+/**
+ * tl_stream_feed:
+ * @stream: The stream
+ * @bytes: The next piece of the text
+ * @length_in_bytes: Length of @bytes, in bytes
+ *
+ * Adds @bytes to the text of @stream. The pieces may be cut anywhere, including
+ * in the middle of a UTF-8 sequence, an emoji sequence or a link. Everything up
+ * to the last whitespace seen so far is handled right away, the rest is kept
+ * until more input arrives.
+ */
+void
+tl_stream_feed (TlStream   *stream,
+                const char *bytes,
+                gsize       length_in_bytes)
+{
+  GString *pending;
+  char before;
+  gsize first_cut, last_cut;
+
+  g_return_if_fail (stream != NULL);
+  g_return_if_fail (!stream->finished);
+
+  if (bytes == NULL || length_in_bytes == 0) {
+    return;
+  }
+
+  pending = stream->pending;
+  before = pending->len > 0 ? pending->str[pending->len - 1] : '\0';
+
+  for (first_cut = 0; first_cut < length_in_bytes; first_cut ++) {
+    if (stream_cut_at (first_cut > 0 ? bytes[first_cut - 1] : before, bytes + first_cut)) {
+      break;
+    }
+  }
+
+  if (first_cut == length_in_bytes) {
+    g_string_append_len (pending, bytes, length_in_bytes);
+    return;
+  }
+
+  last_cut = length_in_bytes - 1;
+  while (last_cut > first_cut && !stream_cut_at (bytes[last_cut - 1], bytes + last_cut)) {
+    last_cut --;
+  }
+
+  // Only the text that was pending has to be copied, the rest is handled in place
+  g_string_append_len (pending, bytes, first_cut);
+  stream_process (stream, pending->str, pending->len);
+  stream_process (stream, bytes + first_cut, last_cut - first_cut);
+
+  g_string_truncate (pending, 0);
+  g_string_append_len (pending, bytes + last_cut, length_in_bytes - last_cut);
+}
+
+/**
+ * tl_stream_finish:
+ * @stream: The stream
+ *
+ * Handles the rest of the text of @stream. After this, the counts of @stream
+ * cover all of its text and it can't be fed anymore.
+ */
+void
+tl_stream_finish (TlStream *stream)
+{
+  g_return_if_fail (stream != NULL);
+
+  if (stream->finished) {
+    return;
+  }
+
+  stream_process (stream, stream->pending->str, stream->pending->len);
+  g_string_truncate (stream->pending, 0);
+  stream->finished = TRUE;
+}
+
+/**
+ * tl_stream_get_length:
+ * @stream: The stream
+ *
+ * Returns: The length of the text of @stream handled so far, in characters,
+ *   as tl_count_characters() counts it. Until tl_stream_finish() is called,
+ *   this does not include the text after the last whitespace.
+ */
+gsize
+tl_stream_get_length (TlStream *stream)
+{
+  g_return_val_if_fail (stream != NULL, 0);
+
+  return stream->length_in_characters;
+}
+
+/**
+ * tl_stream_get_weighted_length:
+ * @stream: The stream
+ *
+ * Returns: The weighted length of the text of @stream handled so far, as
+ *   tl_count_weighted_characters() counts it. Until tl_stream_finish() is
+ *   called, this does not include the text after the last whitespace.
+ */
+gsize
+tl_stream_get_weighted_length (TlStream *stream)
+{
+  g_return_val_if_fail (stream != NULL, 0);
+
+  return stream->length_in_weighted_characters;
+}
+
+/**
+ * tl_foreach_entity:
+ * @input: (nullable): Text to extract entities from
+ * @length_in_bytes: Length of @input, in bytes
+ * @flags: #TlExtractFlags
+ * @entity_func: Function to call for every entity found
+ * @user_data: User data for @entity_func
+ *
+ * Like tl_extract_entities_n(), but passes the entities to @entity_func, in
+ * order and as soon as they are decided, instead of returning an array. The
+ * start pointer of the entities points into @input.
+ *
+ * This does not allocate any memory, unless @input contains a run of more
+ * than COUNT_WINDOW_SIZE tokens without whitespace.
+ */
+void
+tl_foreach_entity (const char   *input,
+                   gsize         length_in_bytes,
+                   guint         flags,
+                   TlEntityFunc  entity_func,
+                   gpointer      user_data)
+{
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, FALSE, NULL,
+                      extract_mask (flags), entity_func, user_data, FALSE, NULL };
+  TlContext context = { 0, };
+
+  g_return_if_fail (entity_func != NULL);
+  g_return_if_fail (length_in_bytes <= G_MAXUINT32);
+
+  if (input == NULL || input[0] == '\0') {
+    return;
+  }
+
+  parse_input (&context, &sink, input, length_in_bytes);
+  context_clear (&context);
+}
+
+// Bytes tl_entity_iter_next() parses at once, up to the next whitespace
+#define ITER_SEGMENT_LENGTH 4096
+
+// What iter_collect_entity() needs during one iter_fill()
+typedef struct {
+  TlEntityIter *iter;
+  EntitySink *sink;
+  // Where the next iter_fill() starts if the buffer ran full, and the
+  // characters and UTF-16 code units before it
+  const char *resume;
+  gsize resume_n_characters;
+  gsize resume_n_utf16_units;
+} IterFill;
+
+/*
+ * iter_overflow:
+ * @next: The entity that didn't fit in the buffer anymore
+ *
+ * Stops the parse and makes the next iter_fill() start at the last place
+ * before @next_start where the text can be cut, see stream_cut_at(). The
+ * buffered entities from there on are dropped, they will be found again.
+ * If that would drop all of them, the word there has more entities than
+ * fit in the buffer. Then they are kept and the next parse of that word
+ * skips up to the end of the last one.
+ */
+static void
+iter_overflow (IterFill       *fill,
+               const TlEntity *next)
+{
+  TlEntityIter *iter = fill->iter;
+  const char *next_start = next->start;
+  const char *cut = next_start;
+  guint n_kept = iter->n_entities;
+
+  while (cut > iter->p && !stream_cut_at (cut[-1], cut)) {
+    cut --;
+  }
+
+  while (n_kept > 0 && iter->entities[n_kept - 1].start >= cut) {
+    n_kept --;
+  }
+
+  if (n_kept > 0) {
+    iter->n_entities = n_kept;
+    iter->returned_end = NULL;
+  } else {
+    const TlEntity *last = &iter->entities[iter->n_entities - 1];
+
+    iter->returned_end = last->start + last->length_in_bytes;
+  }
+
+  fill->resume = cut;
+  // There is no whitespace between the cut and @next, so this only counts part of a word
+  if (cut > iter->p) {
+    fill->resume_n_characters = next->start_character_index - g_utf8_strlen (cut, next_start - cut);
+    fill->resume_n_utf16_units = next->start_utf16_index - utf16_length (cut, next_start - cut);
+  }
+  fill->sink->truncation_point = next_start;
+}
+
+static void
+iter_collect_entity (const TlEntity *entity,
+                     gpointer        user_data)
+{
+  IterFill *fill = user_data;
+  TlEntityIter *iter = fill->iter;
+  TlEntity *e;
+
+  // Already returned by an earlier parse of the same word
+  if (iter->returned_end != NULL && entity->start < iter->returned_end) {
+    return;
+  }
+
+  if (iter->n_entities == TL_ENTITY_ITER_BUFFER_SIZE) {
+    iter_overflow (fill, entity);
+    return;
+  }
+
+  e = &iter->entities[iter->n_entities];
+  *e = *entity;
+  e->start_character_index += iter->character_index;
+  e->start_utf16_index += iter->utf16_index;
+  iter->n_entities ++;
+}
+
+/*
+ * iter_fill:
+ * @iter: An iterator that has returned all of its buffered entities
+ *
+ * Parses the segment of the input at @iter->p and buffers the entities found
+ * there. No entity reaches past whitespace, so the segments are cut after a
+ * whitespace, the same way #TlStream cuts its input. If the segment holds more
+ * entities than fit in the buffer, see iter_overflow().
+ */
+static void
+iter_fill (TlEntityIter *iter)
+{
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, FALSE, NULL,
+                      extract_mask (iter->flags), iter_collect_entity, NULL, FALSE, NULL };
+  IterFill fill = { iter, &sink, NULL, 0, 0 };
+  TlContext context = { 0, };
+  const char *end = segment_end (iter->p, iter->end, ITER_SEGMENT_LENGTH);
+  PlainLengths plain;
+
+  sink.user_data = &fill;
+  iter->n_entities = 0;
+  iter->next_entity = 0;
+
+  parse_input_plain (&context, &sink, iter->p, end - iter->p, &plain);
+  context_clear (&context);
+
+  if (fill.resume == NULL) {
+    fill.resume = end;
+    fill.resume_n_characters = plain.n_characters;
+    fill.resume_n_utf16_units = plain.n_utf16_units;
+    iter->returned_end = NULL;
+  }
+
+  iter->character_index += fill.resume_n_characters;
+  iter->utf16_index += fill.resume_n_utf16_units;
+  iter->p = fill.resume;
+}
+
+/**
+ * tl_entity_iter_init:
+ * @iter: An uninitialized #TlEntityIter, usually on the stack
+ * @input: (nullable): Text to extract entities from
+ * @length_in_bytes: Length of @input, in bytes
+ * @flags: #TlExtractFlags
+ *
+ * Starts iterating over the entities tl_extract_entities_n() would find in
+ * @input, see tl_entity_iter_next(). @input has to stay around until the
+ * iteration is done. An iterator does not need to be freed.
+ */
+void
+tl_entity_iter_init (TlEntityIter *iter,
+                     const char   *input,
+                     gsize         length_in_bytes,
+                     guint         flags)
+{
+  g_return_if_fail (iter != NULL);
+  g_return_if_fail (length_in_bytes <= G_MAXUINT32);
+
+  if (input == NULL || input[0] == '\0') {
+    length_in_bytes = 0;
+  }
+
+  iter->p = input;
+  iter->end = input + length_in_bytes;
+  iter->flags = flags;
+  iter->character_index = 0;
+  iter->utf16_index = 0;
+  iter->returned_end = NULL;
+  iter->n_entities = 0;
+  iter->next_entity = 0;
+}
+
+/**
+ * tl_entity_iter_next:
+ * @iter: The iterator
+ * @out_entity: (out): Return location for the next entity
+ *
+ * Returns: %TRUE if there was another entity, %FALSE if the iteration is done
+ */
+gboolean
+tl_entity_iter_next (TlEntityIter *iter,
+                     TlEntity     *out_entity)
+{
+  g_return_val_if_fail (iter != NULL, FALSE);
+  g_return_val_if_fail (out_entity != NULL, FALSE);
+
+  while (iter->next_entity == iter->n_entities) {
+    if (iter->p == iter->end) {
+      return FALSE;
+    }
+
+    iter_fill (iter);
+  }
+
+  *out_entity = iter->entities[iter->next_entity];
+  iter->next_entity ++;
+
+  return TRUE;
+}
+
+typedef struct {
+  TlEntity *entities;
+  gsize capacity;
+  gsize n_needed;
+} EntityBuffer;
+
+static void
+buffer_entity (const TlEntity *entity,
+               gpointer        user_data)
+{
+  EntityBuffer *buffer = user_data;
+
+  if (buffer->n_needed < buffer->capacity) {
+    buffer->entities[buffer->n_needed] = *entity;
+  }
+
+  buffer->n_needed ++;
+}
+
+/**
+ * tl_extract_entities_into:
+ * @input: (nullable): Text to extract entities from
+ * @length_in_bytes: Length of @input, in bytes
+ * @entities: (nullable): Caller-owned memory for @capacity entities
+ * @capacity: How many entities fit in @entities
+ * @out_n_written: (out) (optional): Return location for the number of
+ *   entities written to @entities
+ * @out_n_needed: (out) (optional): Return location for the number of
+ *   entities in @input, which is the capacity needed to get all of them
+ *
+ * Like tl_extract_entities_n(), but writes the entities to @entities instead
+ * of allocating an array for them. If there are more than @capacity, the first
+ * @capacity are written.
+ *
+ * Returns: %TRUE if all entities fit in @entities
+ */
+gboolean
+tl_extract_entities_into (const char *input,
+                          gsize       length_in_bytes,
+                          TlEntity   *entities,
+                          gsize       capacity,
+                          gsize      *out_n_written,
+                          gsize      *out_n_needed)
+{
+  EntityBuffer buffer = { entities, capacity, 0 };
+
+  g_return_val_if_fail (entities != NULL || capacity == 0, FALSE);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, FALSE);
+
+  if (input != NULL && input[0] != '\0') {
+    tl_foreach_entity (input, length_in_bytes, TL_EXTRACT_DEFAULT, buffer_entity, &buffer);
+  }
+
+  if (out_n_written != NULL) {
+    *out_n_written = MIN (buffer.n_needed, capacity);
+  }
+  if (out_n_needed != NULL) {
+    *out_n_needed = buffer.n_needed;
+  }
+
+  return buffer.n_needed <= capacity;
+}
+
+static inline gboolean
+is_whitespace_at (const char *p)
+{
+  return token_type_from_char (g_utf8_get_char (p)) == TOK_WHITESPACE;
+}
+
+/*
+ * parse_masked:
+ * @context: Context to use for words that don't fit the token window
+ * @sink: Where to put the entities, with no text entities in its entity_mask
+ *
+ * Without text entities, only the words that contain the '.', '@' or '#' a
+ * wanted entity needs can add anything to @sink. Those words are parsed
+ * in full, so a link can still swallow a mention or hashtag, and the rest of
+ * @input is neither tokenized nor parsed at all. No entity and no lookahead or
+ * lookbehind of the parse functions reaches past whitespace, so each word can
+ * be parsed on its own.
+ */
+static void
+parse_masked (TlContext  *context,
+              EntitySink *sink,
+              const char *input,
+              gsize       length_in_bytes)
+{
+  const char *end = input + length_in_bytes;
+  const char *p = input;
+  gsize character_index = 0;
+  gsize utf16_index = 0;
+  char wanted[3];
+  guint n_wanted = 0;
+
+  if (sink->entity_mask & TL_ENTITY_MASK_LINK) {
+    wanted[n_wanted ++] = '.';
+  }
+  if (sink->entity_mask & TL_ENTITY_MASK_MENTION) {
+    wanted[n_wanted ++] = '@';
+  }
+  if (sink->entity_mask & TL_ENTITY_MASK_HASHTAG) {
+    wanted[n_wanted ++] = '#';
+  }
+
+  if (n_wanted == 0) {
+    return;
+  }
+
+  while (n_wanted < 3) {
+    wanted[n_wanted ++] = wanted[0];
+  }
+
+  for (;;) {
+    const char *candidate = find_any_byte_counting (p, end, wanted[0], wanted[1], wanted[2],
+                                                    &character_index, &utf16_index);
+    const char *word_start = candidate;
+    const char *word_end = candidate;
+    PlainLengths plain;
+    guint first_entity;
+    guint i;
+
+    if (candidate == end) {
+      break;
+    }
+
+    // The part of the word before the candidate was counted as skipped already
+    while (word_start > p) {
+      const char *prev = g_utf8_prev_char (word_start);
+
+      if (is_whitespace_at (prev)) {
+        break;
+      }
+      word_start = prev;
+      character_index --;
+      utf16_index -= 1 + ((guchar)*prev >= 0xF0);
+    }
+
+    // Take the whitespace after the word along, so the word is parsed as if it was followed by it
+    while (word_end < end) {
+      const gboolean whitespace = is_whitespace_at (word_end);
+
+      word_end = MIN (g_utf8_next_char (word_end), end);
+      if (whitespace) {
+        break;
+      }
+    }
+
+    first_entity = sink->entities->len;
+    parse_input_plain (context, sink, word_start, word_end - word_start, &plain);
+    for (i = first_entity; i < sink->entities->len; i ++) {
+      TlEntity *e = &g_array_index (sink->entities, TlEntity, i);
+
+      e->start_character_index += character_index;
+      e->start_utf16_index += utf16_index;
+    }
+
+    character_index += plain.n_characters;
+    utf16_index += plain.n_utf16_units;
+    p = word_end;
+  }
+}
+
+/**
+ * tl_extract_entities_masked_n:
+ * @input: (nullable): Text to extract entities from
+ * @length_in_bytes: Length of @input, in bytes
+ * @mask: #TlEntityMask of the entities to extract
+ * @out_n_entities: (out): Location to store the amount of entities in the returned
+ *   array. If 0, the return value is %NULL.
+ *
+ * Like tl_extract_entities_n() and tl_extract_entities_and_text_n(), but only
+ * extracts the entities whose type is in @mask. Without %TL_ENTITY_MASK_TEXT,
+ * this only looks at the words that could contain one of those, so e.g.
+ * extracting only mentions skips every word without an '@'.
+ *
+ * Returns: (transfer full): An array of #TlEntity. If no entities are found,
+ *   %NULL is returned.
+ */
+TlEntity *
+tl_extract_entities_masked_n (const char *input,
+                              gsize       length_in_bytes,
+                              guint       mask,
+                              gsize      *out_n_entities)
+{
+  TlContext context = { 0, };
+  EntitySink sink = { context_array (&context.entities, sizeof (TlEntity)), 0, 0, G_MAXSIZE, FALSE, NULL,
+                      mask, NULL, NULL, FALSE, NULL };
+
+  g_return_val_if_fail (out_n_entities != NULL, NULL);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, NULL);
+
+  if (input != NULL && input[0] != '\0') {
+    if (mask & TL_ENTITY_MASK_TEXT) {
+      parse_input (&context, &sink, input, length_in_bytes);
+    } else {
+      parse_masked (&context, &sink, input, length_in_bytes);
+    }
+  }
+
+  *out_n_entities = sink.entities->len;
+
+  return steal_entities (&context, sink.entities->len > 0 ? (const TlEntity *)sink.entities->data : NULL);
+}
+
+// Texts a batch worker claims at once
+#define BATCH_BLOCK_SIZE 64
+
+typedef struct {
+  const TlText *texts;
+  gsize n_texts;
+  guint n_blocks;
+  // Index of the next block nobody has claimed yet
+  gint next_block;
+
+  guint count_mode;
+  gsize *counts;
+
+  guint entity_mask;
+  // Number of entities of each text, until tl_extract_entities_batch() turns them into offsets
+  gsize *n_entities;
+  gsize *text_lengths;
+  // For every block, the worker it went to and where its entities start in the entities of that worker
+  guint *block_workers;
+  gsize *block_starts;
+} Batch;
+
+typedef struct {
+  Batch *batch;
+  guint index;
+  TlContext context;
+  GArray *entities;
+} BatchWorker;
+
+static void
+batch_count_block (BatchWorker *worker,
+                   gsize        first,
+                   gsize        end)
+{
+  const Batch *batch = worker->batch;
+  gsize i;
+
+  for (i = first; i < end; i ++) {
+    const TlText *text = &batch->texts[i];
+    EntitySink sink = { NULL, 0, 0, G_MAXSIZE, batch->count_mode == COUNT_COMPACT, NULL, 0, NULL, NULL,
+                        FALSE, NULL };
+
+    if (text->input != NULL && text->length_in_bytes > 0) {
+      count_weighted_characters_normalized (&worker->context, &sink, text->input, text->length_in_bytes,
+                                            batch->count_mode);
+    }
+
+    batch->counts[i] = sink.length_in_weighted_characters;
+  }
+}
+
+static void
+batch_extract_block (BatchWorker *worker,
+                     gsize        first,
+                     gsize        end)
+{
+  const Batch *batch = worker->batch;
+  gsize i;
+
+  for (i = first; i < end; i ++) {
+    const TlText *text = &batch->texts[i];
+    const guint n_before = worker->entities->len;
+    EntitySink sink = { worker->entities, 0, 0, G_MAXSIZE, FALSE, NULL, batch->entity_mask, NULL, NULL,
+                        FALSE, NULL };
+
+    if (text->input != NULL && text->length_in_bytes > 0) {
+      parse_input (&worker->context, &sink, text->input, text->length_in_bytes);
+    }
+
+    batch->n_entities[i] = worker->entities->len - n_before;
+    if (batch->text_lengths != NULL) {
+      batch->text_lengths[i] = sink.length_in_characters;
+    }
+  }
+}
+
+static gpointer
+batch_worker_run (gpointer user_data)
+{
+  BatchWorker *worker = user_data;
+  Batch *batch = worker->batch;
+
+  for (;;) {
+    const guint block = (guint)g_atomic_int_add (&batch->next_block, 1);
+    const gsize first = (gsize)block * BATCH_BLOCK_SIZE;
+    const gsize end = MIN (first + BATCH_BLOCK_SIZE, batch->n_texts);
+
+    if (block >= batch->n_blocks) {
+      break;
+    }
+
+    if (batch->counts != NULL) {
+      batch_count_block (worker, first, end);
+    } else {
+      batch->block_workers[block] = worker->index;
+      batch->block_starts[block] = worker->entities->len;
+      batch_extract_block (worker, first, end);
+    }
+  }
+
+  return NULL;
+}
+
+/*
+ * batch_texts_fit:
+ *
+ * Returns: Whether every text of @texts is short enough to be passed to
+ *   tl_count_characters_n() and friends on its own
+ */
+static gboolean
+batch_texts_fit (const TlText *texts,
+                 gsize         n_texts)
+{
+  gsize i;
+
+  for (i = 0; i < n_texts; i ++) {
+    if (texts[i].length_in_bytes > G_MAXUINT32) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/*
+ * batch_run:
+ * @batch: The batch, with everything but the block bookkeeping set up
+ * @n_threads: The number of threads to use, or 0 for one per processor
+ *
+ * Runs @batch on up to @n_threads threads, counting the calling thread. The
+ * threads claim blocks of BATCH_BLOCK_SIZE texts until none are left, so a
+ * thread that got short texts just claims more blocks. Every thread has its
+ * own #TlContext and entity array.
+ *
+ * Returns: (transfer full): The workers, to be freed with batch_workers_free()
+ */
+static BatchWorker *
+batch_run (Batch *batch,
+           guint *n_threads)
+{
+  BatchWorker *workers;
+  GThread **threads;
+  guint i;
+
+  batch->n_blocks = (batch->n_texts + BATCH_BLOCK_SIZE - 1) / BATCH_BLOCK_SIZE;
+  batch->next_block = 0;
+
+  if (*n_threads == 0) {
+    *n_threads = g_get_num_processors ();
+  }
+  *n_threads = MAX (1, MIN (*n_threads, batch->n_blocks));
+
+  workers = g_new0 (BatchWorker, *n_threads);
+  threads = g_new0 (GThread *, *n_threads);
+
+  for (i = 0; i < *n_threads; i ++) {
+    workers[i].batch = batch;
+    workers[i].index = i;
+    workers[i].entities = g_array_new (FALSE, FALSE, sizeof (TlEntity));
+  }
+
+  for (i = 1; i < *n_threads; i ++) {
+    threads[i] = g_thread_new ("tl-batch", batch_worker_run, &workers[i]);
+  }
+
+  batch_worker_run (&workers[0]);
+
+  for (i = 1; i < *n_threads; i ++) {
+    g_thread_join (threads[i]);
+  }
+
+  g_free (threads);
+
+  return workers;
+}
+
+static void
+batch_workers_free (BatchWorker *workers,
+                    guint        n_workers)
+{
+  guint i;
+
+  for (i = 0; i < n_workers; i ++) {
+    context_clear (&workers[i].context);
+    g_array_free (workers[i].entities, TRUE);
+  }
+
+  g_free (workers);
+}
+
+/**
+ * tl_count_weighted_characters_batch:
+ * @texts: (array length=n_texts): The texts to count
+ * @n_texts: The number of texts in @texts
+ * @count_mode: How to count, see tl_count_weighted_characters()
+ * @n_threads: The number of threads to use, or 0 for one per processor
+ * @out_counts: (array length=n_texts): Return location for the weighted
+ *   length of every text in @texts, in the same order
+ *
+ * Does the same as calling tl_count_weighted_characters() for each text, spread
+ * over @n_threads threads.
+ */
+void
+tl_count_weighted_characters_batch (const TlText *texts,
+                                    gsize         n_texts,
+                                    guint         count_mode,
+                                    guint         n_threads,
+                                    gsize        *out_counts)
+{
+  Batch batch = { 0, };
+
+  g_return_if_fail (texts != NULL || n_texts == 0);
+  g_return_if_fail (out_counts != NULL || n_texts == 0);
+  g_return_if_fail (batch_texts_fit (texts, n_texts));
+
+  if (n_texts == 0) {
+    return;
+  }
+
+  batch.texts = texts;
+  batch.n_texts = n_texts;
+  batch.count_mode = count_mode;
+  batch.counts = out_counts;
+
+  batch_workers_free (batch_run (&batch, &n_threads), n_threads);
+}
+
+/**
+ * tl_extract_entities_batch:
+ * @texts: (array length=n_texts): The texts to extract entities from
+ * @n_texts: The number of texts in @texts
+ * @flags: #TlExtractFlags
+ * @n_threads: The number of threads to use, or 0 for one per processor
+ * @out_offsets: (array): Return location for @n_texts + 1 offsets. The
+ *   entities of text i are the ones from out_offsets[i] up to out_offsets[i + 1]
+ *   in the returned array, and out_offsets[n_texts] is the total number of entities.
+ * @out_text_lengths: (array length=n_texts) (optional): Return location for the
+ *   length of every text in @texts, in characters, like tl_extract_entities() returns it
+ *
+ * Does the same as calling tl_extract_entities_n() (or
+ * tl_extract_entities_and_text_n() with %TL_EXTRACT_TEXT) for each text,
+ * spread over @n_threads threads, but returns all entities in one array.
+ *
+ * Returns: (transfer full): The entities of all texts, in the order of @texts.
+ *   If no entities are found, %NULL is returned.
+ */
+TlEntity *
+tl_extract_entities_batch (const TlText *texts,
+                           gsize         n_texts,
+                           guint         flags,
+                           guint         n_threads,
+                           gsize        *out_offsets,
+                           gsize        *out_text_lengths)
+{
+  Batch batch = { 0, };
+  BatchWorker *workers;
+  TlEntity *result;
+  gsize total, i;
+  guint block;
+
+  g_return_val_if_fail (texts != NULL || n_texts == 0, NULL);
+  g_return_val_if_fail (out_offsets != NULL, NULL);
+  g_return_val_if_fail (batch_texts_fit (texts, n_texts), NULL);
+
+  out_offsets[0] = 0;
+
+  if (n_texts == 0) {
+    return NULL;
+  }
+
+  batch.texts = texts;
+  batch.n_texts = n_texts;
+  batch.entity_mask = extract_mask (flags);
+  batch.n_entities = out_offsets + 1;
+  batch.text_lengths = out_text_lengths;
+  batch.block_workers = g_new (guint, (n_texts + BATCH_BLOCK_SIZE - 1) / BATCH_BLOCK_SIZE);
+  batch.block_starts = g_new (gsize, (n_texts + BATCH_BLOCK_SIZE - 1) / BATCH_BLOCK_SIZE);
+
+  workers = batch_run (&batch, &n_threads);
+
+  for (i = 0; i < n_texts; i ++) {
+    out_offsets[i + 1] += out_offsets[i];
+  }
+  total = out_offsets[n_texts];
+
+  // The entities of a block are in one piece in the array of the worker that did it
+  result = total > 0 ? g_new (TlEntity, total) : NULL;
+  for (block = 0; block < batch.n_blocks; block ++) {
+    const GArray *entities = workers[batch.block_workers[block]].entities;
+    const gsize first = out_offsets[(gsize)block * BATCH_BLOCK_SIZE];
+    const gsize end = out_offsets[MIN ((gsize)(block + 1) * BATCH_BLOCK_SIZE, n_texts)];
+
+    if (end == first) {
+      continue;
+    }
+
+    memcpy (result + first,
+            &g_array_index (entities, TlEntity, batch.block_starts[block]),
+            (end - first) * sizeof (TlEntity));
+  }
+
+  batch_workers_free (workers, n_threads);
+  g_free (batch.block_workers);
+  g_free (batch.block_starts);
+
+  return result;
+}
+
+// Minimum length of the segments a #TlEditor splits its text into
+#define EDITOR_SEGMENT_LENGTH 256
+
+/*
+ * A piece of the text of a #TlEditor that ends where the text can be cut,
+ * see stream_cut_at(), and what it adds to the counts.
+ */
+typedef struct {
+  gsize length_in_bytes;
+  // Without counting links as LINK_LENGTH, for the character indices of entities
+  gsize n_characters;
+  gsize n_utf16_units;
+  gsize length_in_characters;
+  gsize length_in_weighted_characters;
+} EditorSegment;
+
+/*
+ * Like #TlStream, an editor relies on the text before and after a whitespace
+ * being independent. It keeps the counts of every segment of its text, so an
+ * edit only has to count the segments it touches again.
+ */
+struct _TlEditor {
+  TlContext context;
+  TlCountType count_mode;
+  GString *text;
+  GArray *segments;
+  // The entities of the segments the last edit counted again
+  GArray *changed_entities;
+  gsize length_in_characters;
+  gsize length_in_weighted_characters;
+};
+
+/*
+ * editor_count_segments:
+ * @start: Byte offset in the text of @editor to start at, where the text can be cut
+ * @end: Byte offset of the end of the part of the text to count, where it can be cut
+ * @n_characters: The number of characters before @start
+ * @n_utf16_units: The number of UTF-16 code units before @start
+ * @segments: Array to append the new segments to
+ *
+ * Splits the text between @start and @end into segments, counts them and adds
+ * their entities to the changed entities of @editor.
+ */
+static void
+editor_count_segments (TlEditor *editor,
+                       gsize     start,
+                       gsize     end,
+                       gsize     n_characters,
+                       gsize     n_utf16_units,
+                       GArray   *segments)
+{
+  const char *text = editor->text->str;
+  const char *p = text + start;
+
+  while (p < text + end) {
+    const char *q = segment_end (p, text + end, EDITOR_SEGMENT_LENGTH);
+    EntitySink sink = { editor->changed_entities, 0, 0, G_MAXSIZE, editor->count_mode == COUNT_COMPACT, NULL,
+                        extract_mask (0), NULL, NULL, TRUE, NULL };
+    const guint first_entity = editor->changed_entities->len;
+    SegmentCounts counts;
+    EditorSegment segment;
+    guint i;
+
+    count_segment (&editor->context, &sink, p, q - p, editor->count_mode, &counts);
+
+    for (i = first_entity; i < editor->changed_entities->len; i ++) {
+      TlEntity *e = &g_array_index (editor->changed_entities, TlEntity, i);
+
+      e->start_character_index += n_characters;
+      e->start_utf16_index += n_utf16_units;
+    }
+
+    segment.length_in_bytes = q - p;
+    segment.n_characters = counts.n_characters;
+    segment.n_utf16_units = counts.n_utf16_units;
+    segment.length_in_characters = counts.length_in_characters;
+    segment.length_in_weighted_characters = counts.length_in_weighted_characters;
+    g_array_append_val (segments, segment);
+
+    editor->length_in_characters += segment.length_in_characters;
+    editor->length_in_weighted_characters += segment.length_in_weighted_characters;
+    n_characters += segment.n_characters;
+    n_utf16_units += segment.n_utf16_units;
+    p = q;
+  }
+}
+
+/**
+ * tl_editor_new:
+ * @count_mode: How to count the weighted length, see tl_count_weighted_characters()
+ *
+ * Creates an editor, which keeps the counts of a text that is edited in
+ * small steps, like the text in a compose box, up to date. Each edit only
+ * counts the text around it again. A new editor has an empty text.
+ *
+ * Returns: (transfer full): A new #TlEditor, free it with tl_editor_free()
+ */
+TlEditor *
+tl_editor_new (TlCountType count_mode)
+{
+  TlEditor *editor = g_new0 (TlEditor, 1);
+
+  editor->count_mode = count_mode;
+  editor->text = g_string_new (NULL);
+  editor->segments = g_array_new (FALSE, FALSE, sizeof (EditorSegment));
+  editor->changed_entities = g_array_new (FALSE, FALSE, sizeof (TlEntity));
+
+  return editor;
+}
+
+/**
+ * tl_editor_free:
+ * @editor: (nullable): The editor to free
+ */
+void
+tl_editor_free (TlEditor *editor)
+{
+  if (editor == NULL) {
+    return;
+  }
+
+  context_clear (&editor->context);
+  g_string_free (editor->text, TRUE);
+  g_array_free (editor->segments, TRUE);
+  g_array_free (editor->changed_entities, TRUE);
+  g_free (editor);
+}
+
+/**
+ * tl_editor_apply_edit:
+ * @editor: The editor
+ * @offset: Byte offset in the text of @editor where the edit starts
+ * @deleted_length: Number of bytes to remove from @offset on
+ * @inserted: (nullable): Text to insert at @offset after that
+ * @inserted_length: Length of @inserted, in bytes
+ *
+ * Changes the text of @editor and updates its counts. Only the segments of
+ * the text that the edit touches, cut at whitespace, are counted again, so
+ * this takes time proportional to the size of the edit plus a few hundred
+ * bytes around it. @offset and @offset + @deleted_length have to be at
+ * character boundaries.
+ *
+ * The links, mentions and hashtags in the part of the text that was counted
+ * again are available from tl_editor_get_changed_entities() afterwards.
+ *
+ * Returns: The new weighted length of the text
+ */
+gsize
+tl_editor_apply_edit (TlEditor   *editor,
+                      gsize       offset,
+                      gsize       deleted_length,
+                      const char *inserted,
+                      gsize       inserted_length)
+{
+  GArray *segments;
+  GArray *new_segments;
+  const gsize edit_end = offset + deleted_length;
+  gsize region_start = 0;
+  gsize region_end;
+  gsize n_characters = 0;
+  gsize n_utf16_units = 0;
+  guint first = 0;
+  guint last;
+  guint i;
+
+  g_return_val_if_fail (editor != NULL, 0);
+  g_return_val_if_fail (edit_end <= editor->text->len, editor->length_in_weighted_characters);
+  g_return_val_if_fail (inserted != NULL || inserted_length == 0, editor->length_in_weighted_characters);
+
+  segments = editor->segments;
+  g_array_set_size (editor->changed_entities, 0);
+
+  // Find the segment the edit starts in. A cut right at @offset may not
+  // be one anymore after the edit, so in that case take the segment before.
+  while (first + 1 < segments->len &&
+         region_start + g_array_index (segments, EditorSegment, first).length_in_bytes <= offset) {
+    region_start += g_array_index (segments, EditorSegment, first).length_in_bytes;
+    n_characters += g_array_index (segments, EditorSegment, first).n_characters;
+    n_utf16_units += g_array_index (segments, EditorSegment, first).n_utf16_units;
+    first ++;
+  }
+  if (region_start == offset && first > 0) {
+    first --;
+    region_start -= g_array_index (segments, EditorSegment, first).length_in_bytes;
+    n_characters -= g_array_index (segments, EditorSegment, first).n_characters;
+    n_utf16_units -= g_array_index (segments, EditorSegment, first).n_utf16_units;
+  }
+
+  // And the one it ends in. The cut at its end stays one.
+  last = first;
+  region_end = region_start;
+  for (i = first; i < segments->len; i ++) {
+    const EditorSegment *segment = &g_array_index (segments, EditorSegment, i);
+
+    editor->length_in_characters -= segment->length_in_characters;
+    editor->length_in_weighted_characters -= segment->length_in_weighted_characters;
+    region_end += segment->length_in_bytes;
+    last = i + 1;
+
+    if (region_end > edit_end) {
+      break;
+    }
+  }
+
+  g_string_erase (editor->text, offset, deleted_length);
+  g_string_insert_len (editor->text, offset, inserted != NULL ? inserted : "", inserted_length);
+  region_end = region_end - deleted_length + inserted_length;
+
+  new_segments = g_array_new (FALSE, FALSE, sizeof (EditorSegment));
+  editor_count_segments (editor, region_start, region_end, n_characters, n_utf16_units, new_segments);
+
+  g_array_remove_range (segments, first, last - first);
+  g_array_insert_vals (segments, first, new_segments->data, new_segments->len);
+  g_array_free (new_segments, TRUE);
+
+  return editor->length_in_weighted_characters;
+}
+
+/**
+ * tl_editor_get_text:
+ * @editor: The editor
+ *
+ * Returns: (transfer none): The NUL-terminated text of @editor, valid until
+ *   the next edit
+ */
+const char *
+tl_editor_get_text (TlEditor *editor)
+{
+  g_return_val_if_fail (editor != NULL, NULL);
+
+  return editor->text->str;
+}
+
+/**
+ * tl_editor_get_length:
+ * @editor: The editor
+ *
+ * Returns: The length of the text of @editor, in characters, as
+ *   tl_count_characters() counts it
+ */
+gsize
+tl_editor_get_length (TlEditor *editor)
+{
+  g_return_val_if_fail (editor != NULL, 0);
+
+  return editor->length_in_characters;
+}
+
+/**
+ * tl_editor_get_weighted_length:
+ * @editor: The editor
+ *
+ * Returns: The weighted length of the text of @editor, as
+ *   tl_count_weighted_characters() counts it
+ */
+gsize
+tl_editor_get_weighted_length (TlEditor *editor)
+{
+  g_return_val_if_fail (editor != NULL, 0);
+
+  return editor->length_in_weighted_characters;
+}
+
+/**
+ * tl_editor_get_changed_entities:
+ * @editor: The editor
+ * @out_n_entities: (out): Return location for the number of entities
+ *
+ * Returns the links, mentions and hashtags in the part of the text that the
+ * last edit counted again. Entities in the rest of the text are the same as
+ * before that edit, apart from moving along with it.
+ *
+ * Returns: (transfer none): The entities, valid until the next edit. If there
+ *   are none, %NULL is returned.
+ */
+const TlEntity *
+tl_editor_get_changed_entities (TlEditor *editor,
+                                gsize    *out_n_entities)
+{
+  g_return_val_if_fail (editor != NULL, NULL);
+  g_return_val_if_fail (out_n_entities != NULL, NULL);
+
+  *out_n_entities = editor->changed_entities->len;
+
+  return editor->changed_entities->len > 0 ? (const TlEntity *)editor->changed_entities->data : NULL;
+}
+
+/*
+ * Prefix sums over the entities of a text, as parse_input() emits them: every
+ * text and whitespace token, and every link, mention and hashtag as a whole.
+ * The offset arrays have @n_spans + 1 entries, the last one being the end of
+ * the text.
+ */
+struct _TlPositionIndex {
+  const char *input;
+  gsize length_in_bytes;
+  gboolean compact_emoji;
+  guint n_spans;
+  guint32 *byte_offsets;
+  guint32 *character_offsets;
+  // Links weigh more than their bytes, so these can get past G_MAXUINT32
+  gsize *weighted_offsets;
+  // Whether a span is a link counting as LINK_LENGTH, which can't be split
+  guint8 *links;
+  gboolean short_urls;
+};
+
+typedef struct {
+  TlPositionIndex *index;
+  GArray *byte_offsets;
+  GArray *character_offsets;
+  GArray *weighted_offsets;
+  GArray *links;
+  guint32 character_offset;
+  gsize weighted_offset;
+} PositionIndexBuilder;
+
+static void
+position_index_add_entity (const TlEntity *entity,
+                           gpointer        user_data)
+{
+  PositionIndexBuilder *builder = user_data;
+  const guint32 byte_offset = entity->start - builder->index->input;
+  const guint32 character_offset = entity->start_character_index;
+  const guint8 link = builder->index->short_urls && entity->type == TL_ENT_LINK;
+
+  g_array_append_val (builder->byte_offsets, byte_offset);
+  g_array_append_val (builder->character_offsets, character_offset);
+  g_array_append_val (builder->weighted_offsets, builder->weighted_offset);
+  g_array_append_val (builder->links, link);
+
+  builder->character_offset = character_offset + entity->length_in_characters;
+  builder->weighted_offset += link ? LINK_LENGTH : entity->length_in_weighted_characters;
+}
+
+/*
+ * find_span:
+ * @offsets: Offsets of a #TlPositionIndex, with @n_spans + 1 entries
+ *
+ * Returns: The index of the last entry of @offsets that is at most @value
+ */
+static inline guint
+find_span (const guint32 *offsets,
+           guint          n_spans,
+           gsize          value)
+{
+  guint lower = 0;
+  guint upper = n_spans + 1;
+
+  // offsets[lower] <= value < offsets[upper], with offsets[n_spans + 1] as infinity
+  while (upper - lower > 1) {
+    const guint middle = lower + (upper - lower) / 2;
+
+    if (offsets[middle] <= value) {
+      lower = middle;
+    } else {
+      upper = middle;
+    }
+  }
+
+  return lower;
+}
+
+/*
+ * find_weighted_span:
+ *
+ * Like find_span(), for the weighted offsets of a #TlPositionIndex.
+ */
+static inline guint
+find_weighted_span (const gsize *offsets,
+                    guint        n_spans,
+                    gsize        value)
+{
+  guint lower = 0;
+  guint upper = n_spans + 1;
+
+  while (upper - lower > 1) {
+    const guint middle = lower + (upper - lower) / 2;
+
+    if (offsets[middle] <= value) {
+      lower = middle;
+    } else {
+      upper = middle;
+    }
+  }
+
+  return lower;
+}
+
+// The entities a #TlPositionIndex keeps a span for
+#define POSITION_INDEX_MASK (TL_ENTITY_MASK_TEXT | TL_ENTITY_MASK_LINK | TL_ENTITY_MASK_MENTION | \
+                             TL_ENTITY_MASK_HASHTAG | 1 << TL_ENT_WHITESPACE)
+
+static void
+position_index_builder_init (PositionIndexBuilder *builder,
+                             const char           *input,
+                             gsize                 length_in_bytes,
+                             TlCountType           count_mode)
+{
+  TlPositionIndex *index = g_new0 (TlPositionIndex, 1);
+
+  index->input = input;
+  index->length_in_bytes = length_in_bytes;
+  index->compact_emoji = count_mode == COUNT_COMPACT;
+  index->short_urls = count_mode != COUNT_BASIC;
+
+  builder->index = index;
+  builder->byte_offsets = g_array_new (FALSE, FALSE, sizeof (guint32));
+  builder->character_offsets = g_array_new (FALSE, FALSE, sizeof (guint32));
+  builder->weighted_offsets = g_array_new (FALSE, FALSE, sizeof (gsize));
+  builder->links = g_array_new (FALSE, FALSE, sizeof (guint8));
+  builder->character_offset = 0;
+  builder->weighted_offset = 0;
+}
+
+/*
+ * position_index_builder_finish:
+ * @builder: A builder that got every span of its text
+ *
+ * Returns: (transfer full): The index @builder built
+ */
+static TlPositionIndex *
+position_index_builder_finish (PositionIndexBuilder *builder)
+{
+  TlPositionIndex *index = builder->index;
+  const guint32 end_offset = index->length_in_bytes;
+
+  index->n_spans = builder->byte_offsets->len;
+
+  g_array_append_val (builder->byte_offsets, end_offset);
+  g_array_append_val (builder->character_offsets, builder->character_offset);
+  g_array_append_val (builder->weighted_offsets, builder->weighted_offset);
+
+  index->byte_offsets = (guint32 *)g_array_free (builder->byte_offsets, FALSE);
+  index->character_offsets = (guint32 *)g_array_free (builder->character_offsets, FALSE);
+  index->weighted_offsets = (gsize *)g_array_free (builder->weighted_offsets, FALSE);
+  index->links = (guint8 *)g_array_free (builder->links, FALSE);
+
+  return index;
+}
+
+/**
+ * tl_position_index_new:
+ * @input: Text to index, which has to stay around as long as the index
+ * @length_in_bytes: Length of @input, in bytes
+ * @count_mode: How to count the weighted length, see tl_count_weighted_characters()
+ *
+ * Counts @input once and keeps the weighted length and character index at the
+ * start of every token, link, mention and hashtag, so the position functions
+ * only have to binary search those and look at one token at most.
+ *
+ * The weighted lengths are those of @input as it is. tl_count_weighted_characters()
+ * counts text in Unicode Normalization Form C, so to get the same results, pass
+ * a text in that form.
+ *
+ * Returns: (transfer full): A new #TlPositionIndex, free it with tl_position_index_free()
+ */
+TlPositionIndex *
+tl_position_index_new (const char  *input,
+                       gsize        length_in_bytes,
+                       TlCountType  count_mode)
+{
+  PositionIndexBuilder builder;
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, count_mode == COUNT_COMPACT, NULL, POSITION_INDEX_MASK,
+                      position_index_add_entity, &builder, FALSE, NULL };
+  TlContext context = { 0, };
+
+  g_return_val_if_fail (input != NULL || length_in_bytes == 0, NULL);
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, NULL);
+
+  position_index_builder_init (&builder, input, length_in_bytes, count_mode);
+
+  if (length_in_bytes > 0) {
+    parse_input (&context, &sink, input, length_in_bytes);
+    context_clear (&context);
+  }
+
+  return position_index_builder_finish (&builder);
+}
+
+/**
+ * tl_position_index_free:
+ * @index: (nullable): The index to free
+ */
+void
+tl_position_index_free (TlPositionIndex *index)
+{
+  if (index == NULL) {
+    return;
+  }
+
+  g_free (index->byte_offsets);
+  g_free (index->character_offsets);
+  g_free (index->weighted_offsets);
+  g_free (index->links);
+  g_free (index);
+}
+
+/*
+ * position_index_weighted_offset:
+ *
+ * Returns: The weighted length of the text before @byte_offset. A link only
+ *   counts once all of it is before @byte_offset.
+ */
+static gsize
+position_index_weighted_offset (const TlPositionIndex *index,
+                                gsize                  byte_offset)
+{
+  guint span;
+
+  if (byte_offset >= index->length_in_bytes) {
+    return index->weighted_offsets[index->n_spans];
+  }
+
+  span = find_span (index->byte_offsets, index->n_spans, byte_offset);
+
+  if (index->links[span]) {
+    return index->weighted_offsets[span];
+  }
+
+  return index->weighted_offsets[span] +
+         text_weight (index->input + index->byte_offsets[span],
+                      byte_offset - index->byte_offsets[span],
+                      index->compact_emoji);
+}
+
+/**
+ * tl_position_index_get_weighted_length:
+ * @index: The index
+ * @start_byte: Byte offset of the start of the range, at a character boundary
+ * @end_byte: Byte offset of the end of the range, at a character boundary
+ *
+ * Returns: The weighted length of the text between @start_byte and @end_byte,
+ *   counting links as LINK_LENGTH where the count mode does. A link only
+ *   counts if the range contains all of it.
+ */
+gsize
+tl_position_index_get_weighted_length (TlPositionIndex *index,
+                                       gsize            start_byte,
+                                       gsize            end_byte)
+{
+  gsize start_weight, end_weight;
+
+  g_return_val_if_fail (index != NULL, 0);
+
+  if (end_byte <= start_byte) {
+    return 0;
+  }
+
+  start_weight = position_index_weighted_offset (index, start_byte);
+  end_weight = position_index_weighted_offset (index, end_byte);
+
+  // A link the range starts in the middle of doesn't count at all
+  if (start_byte < index->length_in_bytes) {
+    const guint span = find_span (index->byte_offsets, index->n_spans, start_byte);
+
+    if (index->links[span] && index->byte_offsets[span] != start_byte) {
+      start_weight = MIN (index->weighted_offsets[span + 1], end_weight);
+    }
+  }
+
+  return end_weight - start_weight;
+}
+
+/**
+ * tl_position_index_get_byte_offset_for_weighted:
+ * @index: The index
+ * @weighted_length: The weighted length to look for
+ *
+ * Returns: The largest byte offset such that the text before it has a weighted
+ *   length of at most @weighted_length. This never cuts a link or an emoji
+ *   sequence in half. Use tl_find_truncation_offset() to truncate a text, which
+ *   also takes care of text that might turn into a link if it was cut.
+ */
+gsize
+tl_position_index_get_byte_offset_for_weighted (TlPositionIndex *index,
+                                                gsize            weighted_length)
+{
+  guint span;
+
+  g_return_val_if_fail (index != NULL, 0);
+
+  span = find_weighted_span (index->weighted_offsets, index->n_spans, weighted_length);
+
+  if (span == index->n_spans) {
+    return index->length_in_bytes;
+  }
+
+  if (index->links[span]) {
+    return index->byte_offsets[span];
+  }
+
+  return index->byte_offsets[span] +
+         truncate_chars (index->input + index->byte_offsets[span],
+                         index->byte_offsets[span + 1] - index->byte_offsets[span],
+                         index->compact_emoji,
+                         weighted_length - index->weighted_offsets[span]);
+}
+
+/**
+ * tl_position_index_get_byte_offset_for_character:
+ * @index: The index
+ * @character_index: Index of a character in the text of @index
+ *
+ * Returns: The byte offset of that character, or the length of the text if
+ *   @character_index is past its end
+ */
+gsize
+tl_position_index_get_byte_offset_for_character (TlPositionIndex *index,
+                                                 gsize            character_index)
+{
+  const char *start;
+  guint span;
+
+  g_return_val_if_fail (index != NULL, 0);
+
+  span = find_span (index->character_offsets, index->n_spans, character_index);
+
+  if (span == index->n_spans) {
+    return index->length_in_bytes;
+  }
+
+  start = index->input + index->byte_offsets[span];
+
+  return index->byte_offsets[span] +
+         (g_utf8_offset_to_pointer (start, character_index - index->character_offsets[span]) - start);
+}
+
+/**
+ * tl_position_index_get_character_for_byte_offset:
+ * @index: The index
+ * @byte_offset: Byte offset in the text of @index, at a character boundary
+ *
+ * Returns: The index of the character at @byte_offset, or the number of
+ *   characters in the text if @byte_offset is past its end
+ */
+gsize
+tl_position_index_get_character_for_byte_offset (TlPositionIndex *index,
+                                                 gsize            byte_offset)
+{
+  const char *start;
+  guint span;
+
+  g_return_val_if_fail (index != NULL, 0);
+
+  if (byte_offset >= index->length_in_bytes) {
+    return index->character_offsets[index->n_spans];
+  }
+
+  span = find_span (index->byte_offsets, index->n_spans, byte_offset);
+  start = index->input + index->byte_offsets[span];
+
+  return index->character_offsets[span] +
+         g_utf8_pointer_to_offset (start, index->input + byte_offset);
+}
+
+/*
+ * TlDocument:
+ *
+ * Everything the tl_document_* functions have worked out about one text. The
+ * first of them to be called parses the text, once and with compact emoji,
+ * see document_parse(). That gives the counts for all modes, like count_all()
+ * does, and every span a #TlPositionIndex needs. The other views are made
+ * from those spans the first time they are asked for:
+ *
+ * - The entities with text, and the ones without
+ * - A #TlPositionIndex per count mode
+ */
+struct _TlDocument {
+  const char *input;
+  gsize length_in_bytes;
+
+  TlCounts counts;
+  // Every text, whitespace, link, mention and hashtag, weighted without compact emoji
+  GArray *spans;
+  // The weighted lengths of @spans with compact emoji
+  guint32 *compact_weights;
+
+  GArray *entities_and_text;
+  GArray *entities;
+
+  TlPositionIndex *position_indices[COUNT_COMPACT + 1];
+};
+
+/**
+ * tl_document_new:
+ * @input: (nullable): Text to look at, which has to stay around as long as the document
+ * @length_in_bytes: Length of @input, in bytes
+ *
+ * Creates a handle for @input that keeps what the tl_document_* functions
+ * find out about it. @input is parsed once, the first time one of them is
+ * called, and the counts, entities and position indices all come from that
+ * parse.
+ *
+ * Returns: (transfer full): A new #TlDocument, free it with tl_document_free()
+ */
+TlDocument *
+tl_document_new (const char *input,
+                 gsize       length_in_bytes)
+{
+  TlDocument *document;
+
+  g_return_val_if_fail (length_in_bytes <= G_MAXUINT32, NULL);
+
+  document = g_new0 (TlDocument, 1);
+
+  if (input != NULL && input[0] != '\0') {
+    document->input = input;
+    document->length_in_bytes = length_in_bytes;
+  } else {
+    document->input = "";
+  }
+
+  return document;
+}
+
+/**
+ * tl_document_free:
+ * @document: (nullable): The document to free, along with everything it keeps
+ */
+void
+tl_document_free (TlDocument *document)
+{
+  guint i;
+
+  if (document == NULL) {
+    return;
+  }
+
+  if (document->spans != NULL) {
+    g_array_free (document->spans, TRUE);
+  }
+  g_free (document->compact_weights);
+  if (document->entities_and_text != NULL) {
+    g_array_free (document->entities_and_text, TRUE);
+  }
+  if (document->entities != NULL) {
+    g_array_free (document->entities, TRUE);
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (document->position_indices); i ++) {
+    tl_position_index_free (document->position_indices[i]);
+  }
+
+  g_free (document);
+}
+
+/*
+ * document_parse:
+ * @document: The document
+ *
+ * Parses the text of @document, unless that happened already. The weighted
+ * counts are of the text in NFC, see normalize_weighted_length(), the spans
+ * are of the text as it is, like tl_position_index_new() counts it.
+ */
+static void
+document_parse (TlDocument *document)
+{
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, TRUE, NULL, POSITION_INDEX_MASK, NULL, NULL, TRUE, NULL };
+  TlContext context = { 0, };
+  PlainLengths plain = { 0, 0, 0 };
+  TlCounts *counts = &document->counts;
+  LinkWeights links = { 0, 0 };
+  guint i;
+
+  if (document->spans != NULL) {
+    return;
+  }
+
+  sink.entities = g_array_new (FALSE, FALSE, sizeof (TlEntity));
+  sink.compact_weights = g_array_new (FALSE, FALSE, sizeof (guint32));
+  if (document->length_in_bytes > 0) {
+    parse_input_plain (&context, &sink, document->input, document->length_in_bytes, &plain);
+  }
+
+  document->spans = sink.entities;
+  document->compact_weights = (guint32 *)g_array_free (sink.compact_weights, FALSE);
+
+  for (i = 0; i < document->spans->len; i ++) {
+    const TlEntity *e = &g_array_index (document->spans, TlEntity, i);
+
+    if (e->type == TL_ENT_LINK) {
+      links.n_links ++;
+      links.length_in_weighted_characters += e->length_in_weighted_characters;
+    }
   }
 
-  return entities;
+  counts->characters = sink.length_in_characters;
+  counts->weighted_basic = normalize_weighted_length (&context, document->input, document->length_in_bytes,
+                                                      COUNT_BASIC, plain.length_in_weighted_characters);
+  counts->weighted_short_urls = normalize_weighted_length (&context, document->input, document->length_in_bytes,
+                                                           COUNT_SHORT_URLS,
+                                                           plain.length_in_weighted_characters -
+                                                           links.length_in_weighted_characters +
+                                                           links.n_links * LINK_LENGTH);
+  counts->weighted_compact = normalize_weighted_length (&context, document->input, document->length_in_bytes,
+                                                        COUNT_COMPACT, sink.length_in_weighted_characters);
+
+  context_clear (&context);
 }
 
-static gsize
-count_entities_in_characters (GArray *entities)
+static const TlCounts *
+document_get_counts (TlDocument *document)
 {
-  guint i;
-  gsize sum = 0;
-
-  for (i = 0; i < entities->len; i ++) {
-    const TlEntity *e = &g_array_index (entities, TlEntity, i);
-
-    sum += entity_length_in_characters (e);
-  }
+  document_parse (document);
 
-  return sum;
+  return &document->counts;
 }
 
-/*
- * tl_count_chars:
- * input: (nullable): NUL-terminated tweet text
+/**
+ * tl_document_get_length:
+ * @document: The document
  *
- * Returns: The length of @input, in characters.
+ * Returns: What tl_count_characters_n() returns for the text of @document
  */
 gsize
-tl_count_characters (const char *input)
+tl_document_get_length (TlDocument *document)
 {
-  if (input == NULL || input[0] == '\0') {
-    return 0;
-  }
+  g_return_val_if_fail (document != NULL, 0);
 
-  return tl_count_characters_n (input, strlen (input));
+  return document_get_counts (document)->characters;
 }
 
-/*
- * tl_count_characters_n:
- * input: (nullable): Text to measure
- * length_in_bytes: Length of @input, in bytes.
+/**
+ * tl_document_get_weighted_length:
+ * @document: The document
+ * @count_mode: How to count the text, see tl_count_weighted_characters()
  *
- * Returns: The length of @input, in characters.
+ * Returns: What tl_count_weighted_characters() returns for the text of @document
  */
 gsize
-tl_count_characters_n (const char *input,
-                       gsize       length_in_bytes)
+tl_document_get_weighted_length (TlDocument  *document,
+                                 TlCountType  count_mode)
 {
-  GArray *tokens;
-  const Token *token_array;
-  gsize n_tokens;
-  GArray *entities;
-  gsize length;
-
-  if (input == NULL || input[0] == '\0') {
-    return 0;
-  }
+  const TlCounts *counts;
 
-  // From here on, input/length_in_bytes are trusted to be OK
-  tokens = tokenize (input, length_in_bytes, FALSE);
+  g_return_val_if_fail (document != NULL, 0);
 
-  n_tokens = tokens->len;
-  token_array = (const Token *)g_array_free (tokens, FALSE);
+  g_return_val_if_fail (count_mode <= COUNT_COMPACT, 0);
 
-  entities = parse (token_array, n_tokens, FALSE, NULL);
+  counts = document_get_counts (document);
 
-  length = count_entities_in_characters (entities);
-  g_array_free (entities, TRUE);
-  g_free ((char *)token_array);
+  if (count_mode == COUNT_BASIC) {
+    return counts->weighted_basic;
+  }
 
-  return length;
+  return count_mode == COUNT_COMPACT ? counts->weighted_compact : counts->weighted_short_urls;
 }
 
-static inline gsize
-entity_length_in_weighted_characters (const TlEntity *e)
+/**
+ * tl_document_get_entities:
+ * @document: The document
+ * @flags: #TlExtractFlags
+ * @out_n_entities: (out): Where to store the number of entities
+ * @out_text_length: (out) (optional): Where to store the length of the text, in characters
+ *
+ * Returns the entities tl_extract_entities_n(), or with %TL_EXTRACT_TEXT
+ * tl_extract_entities_and_text_n(), finds in the text of @document.
+ *
+ * Returns: (transfer none): The entities, owned by @document
+ */
+const TlEntity *
+tl_document_get_entities (TlDocument *document,
+                          guint       flags,
+                          gsize      *out_n_entities,
+                          gsize      *out_text_length)
 {
-  switch (e->type) {
-    case TL_ENT_LINK:
-      return LINK_LENGTH;
+  const guint mask = extract_mask (flags);
+  GArray **entities_p;
+  GArray *entities;
 
-    default:
-      return e->length_in_weighted_characters;
-  }
-}
+  g_return_val_if_fail (document != NULL, NULL);
+  g_return_val_if_fail (out_n_entities != NULL, NULL);
 
-static gsize
-count_entities_in_weighted_characters (GArray *entities)
-{
-  guint i;
-  gsize sum = 0;
+  document_parse (document);
 
-  for (i = 0; i < entities->len; i ++) {
-    const TlEntity *e = &g_array_index (entities, TlEntity, i);
+  entities_p = (flags & TL_EXTRACT_TEXT) ? &document->entities_and_text : &document->entities;
+
+  if (*entities_p == NULL) {
+    guint i;
+
+    *entities_p = g_array_new (FALSE, FALSE, sizeof (TlEntity));
+
+    for (i = 0; i < document->spans->len; i ++) {
+      const TlEntity *e = &g_array_index (document->spans, TlEntity, i);
+
+      if ((mask & (1 << e->type)) != 0) {
+        g_array_append_vals (*entities_p, e, 1);
+      }
+    }
+  }
+  entities = *entities_p;
 
-    sum += entity_length_in_weighted_characters (e);
+  if (out_text_length != NULL) {
+    *out_text_length = document->counts.characters;
   }
+  *out_n_entities = entities->len;
 
-  return sum;
+  return entities->len > 0 ? (const TlEntity *)entities->data : NULL;
 }
 
-/*
- * tl_count_weighted_chararacters:
- * input: (nullable): NUL-terminated tweet text
- * count_mode: COUNT_BASIC to do a dumb weighting count,
- *    COUNT_SHORT_URLS to do dumb weighting count but with URLs only counting as short url
- *    or COUNT_COMPACT for full short URL and compact emoji behaviour
+/**
+ * tl_document_get_position_index:
+ * @document: The document
+ * @count_mode: How to count the text, see tl_count_weighted_characters()
  *
- * Returns: The length of @input, in Twitter's weighted characters.
+ * Returns: (transfer none): A #TlPositionIndex for the text of @document,
+ *   owned by @document
  */
-gsize
-tl_count_weighted_characters (const char *input, guint count_mode)
+TlPositionIndex *
+tl_document_get_position_index (TlDocument  *document,
+                                TlCountType  count_mode)
 {
-  if (input == NULL || input[0] == '\0') {
-    return 0;
-  }
+  g_return_val_if_fail (document != NULL, NULL);
+  g_return_val_if_fail (count_mode <= COUNT_COMPACT, NULL);
 
-  char *normalised = g_utf8_normalize (input, -1, G_NORMALIZE_DEFAULT_COMPOSE);
-  gsize size = 0;
+  if (document->position_indices[count_mode] == NULL) {
+    PositionIndexBuilder builder;
+    guint i;
 
-  if (count_mode == COUNT_SHORT_URLS) {
-    size = tl_count_weighted_characters_n (normalised, strlen (normalised), FALSE);
-  }
-  else if (count_mode == COUNT_COMPACT) {
-    size = tl_count_weighted_characters_n (normalised, strlen (normalised), TRUE);
-  }
-  else {
-    const char *p = normalised;
-    gunichar c;
+    document_parse (document);
+
+    position_index_builder_init (&builder, document->input, document->length_in_bytes, count_mode);
+    for (i = 0; i < document->spans->len; i ++) {
+      TlEntity e = g_array_index (document->spans, TlEntity, i);
 
-    c = g_utf8_get_char (p);
-    while (c != '\0') {
-      size += is_weighted_character (c) ? WEIGHTED_VALUE : UNWEIGHTED_VALUE;
-      p = g_utf8_next_char (p);
-      c = g_utf8_get_char (p);
+      if (count_mode == COUNT_COMPACT) {
+        e.length_in_weighted_characters = document->compact_weights[i];
+      }
+      position_index_add_entity (&e, &builder);
     }
+
+    document->position_indices[count_mode] = position_index_builder_finish (&builder);
   }
 
-  g_free(normalised);
-  return size;
+  return document->position_indices[count_mode];
 }
 
+// Size of the buffer a Utf16Reader starts out with, in bytes
+#define UTF16_BUFFER_SIZE 1024
+
+// The longest UTF-16 text that is sure to fit in G_MAXUINT32 bytes of UTF-8,
+// which takes at most three bytes per code unit
+#define UTF16_MAX_UNITS (G_MAXUINT32 / 3)
+
 /*
- * tl_count_weighted_characters_n:
- * input: (nullable): Text to measure
- * length_in_bytes: Length of @input, in bytes.
- * compact_emoji: whether to count joined emoji as a compacted single character
+ * Utf16Reader:
  *
- * Returns: The length of @input, in characters.
+ * Turns UTF-16 text into UTF-8 a segment at a time, so the rest of the
+ * library can work on it without a UTF-8 copy of the whole text. Like the
+ * ones of #TlStream, segments are cut where stream_cut_at() allows, so each
+ * one can be parsed on its own. The buffer only grows past
+ * UTF16_BUFFER_SIZE for a run without whitespace that doesn't fit in it.
  */
-gsize
-tl_count_weighted_characters_n (const char *input,
-                                gsize       length_in_bytes,
-                                gboolean    compact_emoji)
+typedef struct {
+  const gunichar2 *p;
+  const gunichar2 *end;
+  char *buffer;
+  gsize allocated;
+  gsize filled;
+  // Bytes at the start of @buffer that utf16_reader_next() returned last time
+  gsize segment_length;
+  char stack_buffer[UTF16_BUFFER_SIZE];
+} Utf16Reader;
+
+static void
+utf16_reader_init (Utf16Reader     *reader,
+                   const gunichar2 *input,
+                   gsize            length_in_units)
 {
-  GArray *tokens;
-  const Token *token_array;
-  gsize n_tokens;
-  GArray *entities;
-  gsize length;
+  reader->p = input;
+  reader->end = input + length_in_units;
+  reader->buffer = reader->stack_buffer;
+  reader->allocated = UTF16_BUFFER_SIZE;
+  reader->filled = 0;
+  reader->segment_length = 0;
+}
 
-  if (input == NULL || input[0] == '\0') {
-    return 0;
+static void
+utf16_reader_clear (Utf16Reader *reader)
+{
+  if (reader->buffer != reader->stack_buffer) {
+    g_free (reader->buffer);
   }
-
-  // From here on, input/length_in_bytes are trusted to be OK
-  tokens = tokenize (input, length_in_bytes, compact_emoji);
-
-  n_tokens = tokens->len;
-  token_array = (const Token *)g_array_free (tokens, FALSE);
-
-  entities = parse (token_array, n_tokens, FALSE, NULL);
-
-  length = count_entities_in_weighted_characters (entities);
-  g_array_free (entities, TRUE);
-  g_free ((char *)token_array);
-
-  return length;
 }
 
-/**
- * tl_extract_entities:
- * @input: The input text to extract entities from
- * @out_n_entities: (out): Location to store the amount of entities in the returned
- *   array. If 0, the return value is %NULL.
- * @out_text_length: (out) (optional): Return location for the complete
- *   length of @input, in characters. This is the same value one would
- *   get from calling tl_count_characters() or tl_count_characters_n()
- *   on @input.
+/*
+ * utf16_reader_fill:
  *
- * Returns: An array of #TlEntity. If no entities are found, %NULL is returned.
+ * Converts as much of the rest of the input as fits into the buffer. Surrogate
+ * pairs are converted as a whole, unpaired surrogates become U+FFFD, which
+ * takes one code unit as well.
  */
-TlEntity *
-tl_extract_entities (const char *input,
-                     gsize      *out_n_entities,
-                     gsize      *out_text_length)
+static void
+utf16_reader_fill (Utf16Reader *reader)
 {
-  gsize dummy;
+  const gunichar2 *p = reader->p;
+  const gunichar2 *end = reader->end;
+  char *buffer = reader->buffer;
+  gsize filled = reader->filled;
 
-  g_return_val_if_fail (out_n_entities != NULL, NULL);
+  // A character takes at most four bytes in UTF-8
+  while (p < end && filled + 4 <= reader->allocated) {
+    const gunichar2 c = *p;
+    gunichar ch;
 
-  if (out_text_length == NULL) {
-    out_text_length = &dummy;
-  }
+    p ++;
 
-  if (input == NULL || input[0] == '\0') {
-    *out_n_entities = 0;
-    *out_text_length = 0;
-    return NULL;
+    if (c < 0x80) {
+      buffer[filled ++] = (char)c;
+      continue;
+    }
+
+    if (c >= 0xD800 && c < 0xDC00 && p < end && *p >= 0xDC00 && *p < 0xE000) {
+      ch = 0x10000 + ((c - 0xD800) << 10) + (*p - 0xDC00);
+      p ++;
+    } else if (c >= 0xD800 && c < 0xE000) {
+      ch = 0xFFFD;
+    } else {
+      ch = c;
+    }
+
+    filled += g_unichar_to_utf8 (ch, buffer + filled);
   }
 
-  return tl_extract_entities_n (input, strlen (input), out_n_entities, out_text_length);
+  reader->p = p;
+  reader->filled = filled;
 }
 
-
-static TlEntity *
-tl_extract_entities_internal (const char *input,
-                              gsize       length_in_bytes,
-                              gsize      *out_n_entities,
-                              gsize      *out_text_length,
-                              gboolean    extract_text_entities)
+/*
+ * utf16_reader_next:
+ * @out_segment: (out): Where to store the next segment, valid until the next call
+ * @out_length_in_bytes: (out): Where to store its length
+ *
+ * Returns: %FALSE if all of the input has been returned already
+ */
+static gboolean
+utf16_reader_next (Utf16Reader  *reader,
+                   const char  **out_segment,
+                   gsize        *out_length_in_bytes)
 {
-  GArray *tokens;
-  const Token *token_array;
-  gsize n_tokens;
-  GArray *entities;
-  guint n_relevant_entities;
-  TlEntity *result_entities;
-  guint result_index = 0;
-
-  tokens = tokenize (input, length_in_bytes, FALSE);
-
-#ifdef LIBTL_DEBUG
-  g_debug ("############ %s: %.*s", __FUNCTION__, (guint)length_in_bytes, input);
-  for (guint i = 0; i < tokens->len; i ++) {
-    const Token *t = &g_array_index (tokens, Token, i);
-    g_debug ("Token %u: Type: %d, Length: %u, Text:%.*s, start char: %u, chars: %u", i, t->type, (guint)t->length_in_bytes,
-         (int)t->length_in_bytes, t->start, (guint)t->start_character_index, (guint)t->length_in_characters);
+  if (reader->segment_length > 0) {
+    reader->filled -= reader->segment_length;
+    memmove (reader->buffer, reader->buffer + reader->segment_length, reader->filled);
+    reader->segment_length = 0;
   }
-#endif
 
-  n_tokens = tokens->len;
-  token_array = (const Token *)g_array_free (tokens, FALSE);
-  entities = parse (token_array, n_tokens, extract_text_entities, &n_relevant_entities);
+  for (;;) {
+    gsize cut;
 
-  *out_text_length = count_entities_in_characters (entities);
-  g_free ((char *)token_array);
+    utf16_reader_fill (reader);
 
-#ifdef LIBTL_DEBUG
-  for (guint i = 0; i < entities->len; i ++) {
-    const TlEntity *e = &g_array_index (entities, TlEntity, i);
-    g_debug ("TlEntity %u: Text: '%.*s', Type: %u, Bytes: %u, Length: %u, start character: %u", i, (int)e->length_in_bytes, e->start,
-               e->type, (guint)e->length_in_bytes, (guint)entity_length_in_characters (e), (guint)e->start_character_index);
-  }
-#endif
+    if (reader->p == reader->end) {
+      cut = reader->filled;
+    } else {
+      cut = reader->filled - 1;
+      while (cut > 0 && !stream_cut_at (reader->buffer[cut - 1], reader->buffer + cut)) {
+        cut --;
+      }
+    }
 
-  // Only pass mentions, hashtags and links out
-  result_entities = g_malloc (sizeof (TlEntity) * n_relevant_entities);
-  for (guint i = 0; i < entities->len; i ++) {
-    const TlEntity *e = &g_array_index (entities, TlEntity, i);
-    switch (e->type) {
-      case TL_ENT_LINK:
-      case TL_ENT_HASHTAG:
-      case TL_ENT_MENTION:
-        memcpy (&result_entities[result_index], e, sizeof (TlEntity));
-        result_index ++;
-      break;
+    if (cut > 0) {
+      reader->segment_length = cut;
+      *out_segment = reader->buffer;
+      *out_length_in_bytes = cut;
+      return TRUE;
+    }
 
-      case TL_ENT_TEXT:
-        if (extract_text_entities) {
-          memcpy (&result_entities[result_index], e, sizeof (TlEntity));
-          result_index ++;
-        }
-      break;
+    if (reader->p == reader->end) {
+      return FALSE;
+    }
 
-      default: {}
+    // No whitespace in the whole buffer, make room for more
+    reader->allocated *= 2;
+    if (reader->buffer == reader->stack_buffer) {
+      reader->buffer = g_malloc (reader->allocated);
+      memcpy (reader->buffer, reader->stack_buffer, reader->filled);
+    } else {
+      reader->buffer = g_realloc (reader->buffer, reader->allocated);
     }
   }
-
-  *out_n_entities = n_relevant_entities;
-  g_array_free (entities, TRUE);
-
-  return result_entities;
 }
 
 /**
- * tl_extract_entities_n:
- * @input: The input text to extract entities from
- * @length_in_bytes: The length of @input, in bytes
- * @out_n_entities: (out): Location to store the amount of entities in the returned
- *   array. If 0, the return value is %NULL.
- * @out_text_length: (out) (optional): Return location for the complete
- *   length of @input, in characters. This is the same value one would
- *   get from calling tl_count_characters() or tl_count_characters_n()
- *   on @input.
+ * tl_count_characters_utf16:
+ * @input: (nullable): Tweet text in UTF-16
+ * @length_in_units: Length of @input, in UTF-16 code units
  *
- * Returns: An array of #TlEntity. If no entities are found, %NULL is returned.
+ * Like tl_count_characters_n(), but reads UTF-16 text without converting all
+ * of it to UTF-8 first.
+ *
+ * Returns: The length of @input, in characters.
  */
-TlEntity *
-tl_extract_entities_n (const char *input,
-                       gsize       length_in_bytes,
-                       gsize      *out_n_entities,
-                       gsize      *out_text_length)
+gsize
+tl_count_characters_utf16 (const gunichar2 *input,
+                           gsize            length_in_units)
 {
-  gsize dummy;
-
-  g_return_val_if_fail (out_n_entities != NULL, NULL);
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, FALSE, NULL, 0, NULL, NULL, FALSE, NULL };
+  TlContext context = { 0, };
+  Utf16Reader reader;
+  const char *segment;
+  gsize length_in_bytes;
 
-  if (out_text_length == NULL) {
-    out_text_length = &dummy;
-  }
+  g_return_val_if_fail (input != NULL || length_in_units == 0, 0);
+  g_return_val_if_fail (length_in_units <= UTF16_MAX_UNITS, 0);
 
-  if (input == NULL || input[0] == '\0') {
-    *out_n_entities = 0;
-    *out_text_length = 0;
-    return NULL;
+  utf16_reader_init (&reader, input, length_in_units);
+  while (utf16_reader_next (&reader, &segment, &length_in_bytes)) {
+    parse_input (&context, &sink, segment, length_in_bytes);
   }
+  utf16_reader_clear (&reader);
+  context_clear (&context);
 
-  return tl_extract_entities_internal (input,
-                                       length_in_bytes,
-                                       out_n_entities,
-                                       out_text_length,
-                                       FALSE);
+  return sink.length_in_characters;
 }
 
 /**
- * tl_extract_entities_and_text:
- * @input: The input text to extract entities from
- * @out_n_entities: (out): Location to store the amount of entities in the returned
- *   array. If 0, the return value is %NULL.
- * @out_text_length: (out) (optional): Return location for the complete
- *   length of @input, in characters. This is the same value one would
- *   get from calling tl_count_characters() or tl_count_characters_n()
- *   on @input.
+ * tl_count_weighted_characters_utf16:
+ * @input: (nullable): Tweet text in UTF-16
+ * @length_in_units: Length of @input, in UTF-16 code units
+ * @count_mode: How to count @input, see tl_count_weighted_characters()
  *
- * This is different from tl_extract_entities() in that it returns all entities
- * and not just hashtags, links and mentions. This allows for further post-processing
- * from the caller.
+ * Like tl_count_weighted_characters(), but reads UTF-16 text without
+ * converting all of it to UTF-8 first.
  *
- * Returns: An array of #TlEntity. If no entities are found, %NULL is returned.
+ * Returns: The weighted length of @input.
  */
-TlEntity *
-tl_extract_entities_and_text (const char *input,
-                              gsize      *out_n_entities,
-                              gsize      *out_text_length)
+gsize
+tl_count_weighted_characters_utf16 (const gunichar2 *input,
+                                    gsize            length_in_units,
+                                    guint            count_mode)
 {
-  gsize dummy;
-
-  g_return_val_if_fail (out_n_entities != NULL, NULL);
+  EntitySink sink = { NULL, 0, 0, G_MAXSIZE, count_mode == COUNT_COMPACT, NULL, 0, NULL, NULL, FALSE, NULL };
+  TlContext context = { 0, };
+  Utf16Reader reader;
+  const char *segment;
+  gsize length_in_bytes;
 
-  if (out_text_length == NULL) {
-    out_text_length = &dummy;
-  }
+  g_return_val_if_fail (input != NULL || length_in_units == 0, 0);
+  g_return_val_if_fail (length_in_units <= UTF16_MAX_UNITS, 0);
 
-  if (input == NULL || input[0] == '\0') {
-    *out_n_entities = 0;
-    *out_text_length = 0;
-    return NULL;
+  utf16_reader_init (&reader, input, length_in_units);
+  while (utf16_reader_next (&reader, &segment, &length_in_bytes)) {
+    count_weighted_characters_normalized (&context, &sink, segment, length_in_bytes, count_mode);
   }
+  utf16_reader_clear (&reader);
+  context_clear (&context);
 
-  return tl_extract_entities_internal (input,
-                                       strlen (input),
-                                       out_n_entities,
-                                       out_text_length,
-                                       TRUE);
+  return sink.length_in_weighted_characters;
 }
 
 /**
- * tl_extract_entities_and_text_n:
- * @input: The input text to extract entities from
- * @length_in_bytes: The length of @input, in bytes
- * @out_n_entities: (out): Location to store the amount of entities in the returned
- *   array. If 0, the return value is %NULL.
- * @out_text_length: (out) (optional): Return location for the complete
- *   length of @input, in characters. This is the same value one would
- *   get from calling tl_count_characters() or tl_count_characters_n()
- *   on @input.
+ * tl_extract_entities_utf16:
+ * @input: (nullable): Tweet text in UTF-16
+ * @length_in_units: Length of @input, in UTF-16 code units
+ * @flags: #TlExtractFlags
+ * @out_n_entities: (out): Where to store the number of entities
+ * @out_text_length: (out) (optional): Where to store the length of @input, in characters
  *
- * This is different from tl_extract_entities_n() in that it returns all entities
- * and not just hashtags, links and mentions. This allows for further post-processing
- * from the caller.
+ * Like tl_extract_entities_n(), or with %TL_EXTRACT_TEXT
+ * tl_extract_entities_and_text_n(), but reads UTF-16 text without converting
+ * all of it to UTF-8 first.
  *
- * Returns: An array of #TlEntity. If no entities are found, %NULL is returned.
+ * There is no UTF-8 text for the entities to point into, so their start is
+ * %NULL and their length_in_bytes 0. Use start_utf16_index and
+ * length_in_utf16_units instead.
+ *
+ * Returns: (transfer full): The entities, free them with g_free()
  */
 TlEntity *
-tl_extract_entities_and_text_n (const char *input,
-                                gsize       length_in_bytes,
-                                gsize      *out_n_entities,
-                                gsize      *out_text_length)
+tl_extract_entities_utf16 (const gunichar2 *input,
+                           gsize            length_in_units,
+                           guint            flags,
+                           gsize           *out_n_entities,
+                           gsize           *out_text_length)
 {
-  gsize dummy;
+  EntitySink sink = { g_array_new (FALSE, FALSE, sizeof (TlEntity)), 0, 0, G_MAXSIZE, FALSE, NULL,
+                      extract_mask (flags), NULL, NULL, FALSE, NULL };
+  TlContext context = { 0, };
+  Utf16Reader reader;
+  const char *segment;
+  gsize length_in_bytes;
+  gsize character_index = 0;
+  gsize utf16_index = 0;
 
+  g_return_val_if_fail (input != NULL || length_in_units == 0, NULL);
+  g_return_val_if_fail (length_in_units <= UTF16_MAX_UNITS, NULL);
   g_return_val_if_fail (out_n_entities != NULL, NULL);
 
-  if (out_text_length == NULL) {
-    out_text_length = &dummy;
+  utf16_reader_init (&reader, input, length_in_units);
+  while (utf16_reader_next (&reader, &segment, &length_in_bytes)) {
+    const guint first_entity = sink.entities->len;
+    PlainLengths plain;
+    guint i;
+
+    parse_input_plain (&context, &sink, segment, length_in_bytes, &plain);
+
+    for (i = first_entity; i < sink.entities->len; i ++) {
+      TlEntity *e = &g_array_index (sink.entities, TlEntity, i);
+
+      e->start = NULL;
+      e->length_in_bytes = 0;
+      e->start_character_index += character_index;
+      e->start_utf16_index += utf16_index;
+    }
+
+    // The reader maps every character to the same number of UTF-16 code units
+    // it consumed for it, so the parse already counted this segment's units.
+    character_index += plain.n_characters;
+    utf16_index += plain.n_utf16_units;
   }
+  utf16_reader_clear (&reader);
+  context_clear (&context);
 
-  if (input == NULL || input[0] == '\0') {
-    *out_n_entities = 0;
-    *out_text_length = 0;
+  if (out_text_length != NULL) {
+    *out_text_length = sink.length_in_characters;
+  }
+  *out_n_entities = sink.entities->len;
+
+  if (sink.entities->len == 0) {
+    g_array_free (sink.entities, TRUE);
     return NULL;
   }
 
-  return tl_extract_entities_internal (input,
-                                       length_in_bytes,
-                                       out_n_entities,
-                                       out_text_length,
-                                       TRUE);
+  return (TlEntity *)g_array_free (sink.entities, FALSE);
 }
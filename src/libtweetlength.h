@@ -28,6 +28,10 @@ struct _TlEntity {
   gsize start_character_index;
   gsize length_in_characters;
   gsize length_in_weighted_characters;
+
+  // Where the entity is in UTF-16 code units, like Twitter's API and most UI toolkits count
+  gsize start_utf16_index;
+  gsize length_in_utf16_units;
 };
 typedef struct _TlEntity TlEntity;
 
@@ -45,6 +49,61 @@ typedef enum {
   COUNT_COMPACT
 } TlCountType;
 
+typedef struct _TlContext TlContext;
+typedef struct _TlStream TlStream;
+typedef struct _TlEditor TlEditor;
+typedef struct _TlPositionIndex TlPositionIndex;
+typedef struct _TlDocument TlDocument;
+
+typedef void (*TlEntityFunc) (const TlEntity *entity,
+                              gpointer        user_data);
+
+typedef enum {
+  TL_EXTRACT_DEFAULT = 0,
+  // Also yield text entities, like tl_extract_entities_and_text() does
+  TL_EXTRACT_TEXT    = 1 << 0,
+} TlExtractFlags;
+
+typedef enum {
+  TL_ENTITY_MASK_TEXT    = 1 << TL_ENT_TEXT,
+  TL_ENTITY_MASK_HASHTAG = 1 << TL_ENT_HASHTAG,
+  TL_ENTITY_MASK_LINK    = 1 << TL_ENT_LINK,
+  TL_ENTITY_MASK_MENTION = 1 << TL_ENT_MENTION,
+} TlEntityMask;
+
+// One of the texts passed to the *_batch functions
+struct _TlText {
+  const char *input;
+  gsize length_in_bytes;
+};
+typedef struct _TlText TlText;
+
+// What tl_count_all() fills in
+struct _TlCounts {
+  gsize characters;
+  // tl_count_weighted_characters() with COUNT_BASIC, COUNT_SHORT_URLS and COUNT_COMPACT
+  gsize weighted_basic;
+  gsize weighted_short_urls;
+  gsize weighted_compact;
+};
+typedef struct _TlCounts TlCounts;
+
+#define TL_ENTITY_ITER_BUFFER_SIZE 16
+
+struct _TlEntityIter {
+  /*< private >*/
+  const char *p;
+  const char *end;
+  const char *returned_end;
+  guint flags;
+  gsize character_index;
+  gsize utf16_index;
+  guint n_entities;
+  guint next_entity;
+  TlEntity entities[TL_ENTITY_ITER_BUFFER_SIZE];
+};
+typedef struct _TlEntityIter TlEntityIter;
+
 gsize      tl_count_characters            (const char *input);
 gsize      tl_count_characters_n          (const char *input,
                                            gsize       length_in_bytes);
@@ -53,6 +112,17 @@ gsize      tl_count_weighted_characters   (const char *input,
 gsize      tl_count_weighted_characters_n (const char *input,
                                            gsize       length_in_bytes,
                                            gboolean    compact_emoji);
+gboolean   tl_fits_within                 (const char *input,
+                                           gsize       length_in_bytes,
+                                           gsize       limit,
+                                           guint       count_mode);
+gsize      tl_find_truncation_offset      (const char *input,
+                                           gsize       length_in_bytes,
+                                           gsize       limit,
+                                           guint       count_mode);
+void       tl_count_all                   (const char *input,
+                                           gsize       length_in_bytes,
+                                           TlCounts   *out);
 TlEntity * tl_extract_entities            (const char *input,
                                            gsize      *out_n_entities,
                                            gsize      *out_text_length);
@@ -68,6 +138,149 @@ TlEntity * tl_extract_entities_and_text_n (const char *input,
                                            gsize      *out_n_entities,
                                            gsize      *out_text_length);
 
+TlContext *      tl_context_new                     (void);
+void             tl_context_free                    (TlContext  *context);
+gsize            tl_count_characters_ctx            (TlContext  *context,
+                                                     const char *input);
+gsize            tl_count_characters_n_ctx          (TlContext  *context,
+                                                     const char *input,
+                                                     gsize       length_in_bytes);
+gsize            tl_count_weighted_characters_ctx   (TlContext  *context,
+                                                     const char *input,
+                                                     guint       count_mode);
+gsize            tl_count_weighted_characters_n_ctx (TlContext  *context,
+                                                     const char *input,
+                                                     gsize       length_in_bytes,
+                                                     gboolean    compact_emoji);
+gboolean         tl_fits_within_ctx                 (TlContext  *context,
+                                                     const char *input,
+                                                     gsize       length_in_bytes,
+                                                     gsize       limit,
+                                                     guint       count_mode);
+gsize            tl_find_truncation_offset_ctx      (TlContext  *context,
+                                                     const char *input,
+                                                     gsize       length_in_bytes,
+                                                     gsize       limit,
+                                                     guint       count_mode);
+void             tl_count_all_ctx                   (TlContext  *context,
+                                                     const char *input,
+                                                     gsize       length_in_bytes,
+                                                     TlCounts   *out);
+const TlEntity * tl_extract_entities_ctx            (TlContext  *context,
+                                                     const char *input,
+                                                     gsize      *out_n_entities,
+                                                     gsize      *out_text_length);
+const TlEntity * tl_extract_entities_n_ctx          (TlContext  *context,
+                                                     const char *input,
+                                                     gsize       length_in_bytes,
+                                                     gsize      *out_n_entities,
+                                                     gsize      *out_text_length);
+const TlEntity * tl_extract_entities_and_text_ctx   (TlContext  *context,
+                                                     const char *input,
+                                                     gsize      *out_n_entities,
+                                                     gsize      *out_text_length);
+const TlEntity * tl_extract_entities_and_text_n_ctx (TlContext  *context,
+                                                     const char *input,
+                                                     gsize       length_in_bytes,
+                                                     gsize      *out_n_entities,
+                                                     gsize      *out_text_length);
+
+TlStream * tl_stream_new                      (TlCountType   count_mode,
+                                               gboolean      extract_text_entities,
+                                               TlEntityFunc  entity_func,
+                                               gpointer      user_data);
+void       tl_stream_free                     (TlStream     *stream);
+void       tl_stream_feed                     (TlStream     *stream,
+                                               const char   *bytes,
+                                               gsize         length_in_bytes);
+void       tl_stream_finish                   (TlStream     *stream);
+gsize      tl_stream_get_length               (TlStream     *stream);
+gsize      tl_stream_get_weighted_length      (TlStream     *stream);
+
+void       tl_foreach_entity                  (const char   *input,
+                                               gsize         length_in_bytes,
+                                               guint         flags,
+                                               TlEntityFunc  entity_func,
+                                               gpointer      user_data);
+void       tl_entity_iter_init                (TlEntityIter *iter,
+                                               const char   *input,
+                                               gsize         length_in_bytes,
+                                               guint         flags);
+gboolean   tl_entity_iter_next                (TlEntityIter *iter,
+                                               TlEntity     *out_entity);
+TlEntity * tl_extract_entities_masked_n       (const char   *input,
+                                               gsize         length_in_bytes,
+                                               guint         mask,
+                                               gsize        *out_n_entities);
+gboolean   tl_extract_entities_into           (const char   *input,
+                                               gsize         length_in_bytes,
+                                               TlEntity     *entities,
+                                               gsize         capacity,
+                                               gsize        *out_n_written,
+                                               gsize        *out_n_needed);
+void       tl_count_weighted_characters_batch (const TlText *texts,
+                                               gsize         n_texts,
+                                               guint         count_mode,
+                                               guint         n_threads,
+                                               gsize        *out_counts);
+TlEntity * tl_extract_entities_batch          (const TlText *texts,
+                                               gsize         n_texts,
+                                               guint         flags,
+                                               guint         n_threads,
+                                               gsize        *out_offsets,
+                                               gsize        *out_text_lengths);
+
+TlEditor *       tl_editor_new                  (TlCountType  count_mode);
+void             tl_editor_free                 (TlEditor    *editor);
+gsize            tl_editor_apply_edit           (TlEditor    *editor,
+                                                 gsize        offset,
+                                                 gsize        deleted_length,
+                                                 const char  *inserted,
+                                                 gsize        inserted_length);
+const char *     tl_editor_get_text             (TlEditor    *editor);
+gsize            tl_editor_get_length           (TlEditor    *editor);
+gsize            tl_editor_get_weighted_length  (TlEditor    *editor);
+const TlEntity * tl_editor_get_changed_entities (TlEditor    *editor,
+                                                 gsize       *out_n_entities);
+
+TlPositionIndex * tl_position_index_new                           (const char      *input,
+                                                                   gsize            length_in_bytes,
+                                                                   TlCountType      count_mode);
+void              tl_position_index_free                          (TlPositionIndex *index);
+gsize             tl_position_index_get_weighted_length           (TlPositionIndex *index,
+                                                                   gsize            start_byte,
+                                                                   gsize            end_byte);
+gsize             tl_position_index_get_byte_offset_for_weighted  (TlPositionIndex *index,
+                                                                   gsize            weighted_length);
+gsize             tl_position_index_get_byte_offset_for_character (TlPositionIndex *index,
+                                                                   gsize            character_index);
+gsize             tl_position_index_get_character_for_byte_offset (TlPositionIndex *index,
+                                                                   gsize            byte_offset);
+
+TlDocument *      tl_document_new                 (const char  *input,
+                                                   gsize        length_in_bytes);
+void              tl_document_free                (TlDocument  *document);
+gsize             tl_document_get_length          (TlDocument  *document);
+gsize             tl_document_get_weighted_length (TlDocument  *document,
+                                                   TlCountType  count_mode);
+const TlEntity *  tl_document_get_entities        (TlDocument  *document,
+                                                   guint        flags,
+                                                   gsize       *out_n_entities,
+                                                   gsize       *out_text_length);
+TlPositionIndex * tl_document_get_position_index  (TlDocument  *document,
+                                                   TlCountType  count_mode);
+
+gsize      tl_count_characters_utf16          (const gunichar2 *input,
+                                               gsize            length_in_units);
+gsize      tl_count_weighted_characters_utf16 (const gunichar2 *input,
+                                               gsize            length_in_units,
+                                               guint            count_mode);
+TlEntity * tl_extract_entities_utf16          (const gunichar2 *input,
+                                               gsize            length_in_units,
+                                               guint            flags,
+                                               gsize           *out_n_entities,
+                                               gsize           *out_text_length);
+
 
 
 #endif
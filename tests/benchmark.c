@@ -0,0 +1,229 @@
+/*  This file is part of libtweetlength
+ *  Copyright (C) 2021 IBBoard
+ *
+ *  libtweetlength is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  libtweetlength is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with libtweetlength.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "libtweetlength.h"
+
+#define BENCHMARK_SECONDS 1
+
+// Every word after a dot is looked up as a TLD once, valid or not
+static const char *tld_probe_text =
+    "see example.com and example.org, also foo.notatld or v1.2 "
+    "maybe twitter.co.uk, 삼성.삼성 or 日本.コム but not foo.bar_baz "
+    "then readme.txt and main.c, some.UPPERCASE.COM and x.y.z.zz ";
+
+static void
+bench_tld_probes (void)
+{
+  const gsize length_in_bytes = strlen (tld_probe_text);
+  gsize n_probes = 0;
+  gsize n_calls = 0;
+  gint64 start, elapsed;
+  const char *p;
+
+  for (p = tld_probe_text; *p != '\0'; p ++) {
+    if (*p == '.') {
+      n_probes ++;
+    }
+  }
+
+  start = g_get_monotonic_time ();
+  do {
+    tl_count_characters_n (tld_probe_text, length_in_bytes);
+    n_calls ++;
+    elapsed = g_get_monotonic_time () - start;
+  } while (elapsed < BENCHMARK_SECONDS * G_USEC_PER_SEC);
+
+  printf ("tld-probes: %.0f probes/s (%.2f us per call)\n",
+          (double)(n_probes * n_calls) / elapsed * G_USEC_PER_SEC,
+          (double)elapsed / n_calls);
+}
+
+// Mostly ASCII prose with the odd link, mention and hashtag
+static const char *ascii_text =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor "
+    "incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud "
+    "exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat 2021 @someone "
+    "https://example.com/some/path?query=value #hashtag Duis aute irure dolor in "
+    "reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur. ";
+
+static void
+bench_ascii_text (void)
+{
+  const gsize length_in_bytes = strlen (ascii_text);
+  gsize n_calls = 0;
+  gint64 start, elapsed;
+
+  start = g_get_monotonic_time ();
+  do {
+    tl_count_weighted_characters_n (ascii_text, length_in_bytes, TRUE);
+    n_calls ++;
+    elapsed = g_get_monotonic_time () - start;
+  } while (elapsed < BENCHMARK_SECONDS * G_USEC_PER_SEC);
+
+  printf ("ascii-text: %.1f MB/s (%.2f us per call)\n",
+          (double)(length_in_bytes * n_calls) / elapsed,
+          (double)elapsed / n_calls);
+}
+
+// Long texts used to need all of their tokens in memory at once
+static void
+bench_long_text (void)
+{
+  GString *text = g_string_new (NULL);
+  gsize n_calls = 0;
+  gint64 start, elapsed;
+
+  while (text->len < 256 * 1024) {
+    g_string_append (text, ascii_text);
+  }
+
+  start = g_get_monotonic_time ();
+  do {
+    gsize n_entities;
+    TlEntity *entities = tl_extract_entities_and_text_n (text->str, text->len, &n_entities, NULL);
+
+    g_free (entities);
+    n_calls ++;
+    elapsed = g_get_monotonic_time () - start;
+  } while (elapsed < BENCHMARK_SECONDS * G_USEC_PER_SEC);
+
+  printf ("long-text: %.1f MB/s (%.2f us per call)\n",
+          (double)(text->len * n_calls) / elapsed,
+          (double)elapsed / n_calls);
+
+  g_string_free (text, TRUE);
+}
+
+// Extracting only some kinds of entities skips the words that can't contain them
+static void
+bench_entity_mask (void)
+{
+  const struct {
+    const char *name;
+    guint mask;
+  } masks[] = {
+    { "all", TL_ENTITY_MASK_LINK | TL_ENTITY_MASK_MENTION | TL_ENTITY_MASK_HASHTAG },
+    { "links", TL_ENTITY_MASK_LINK },
+    { "mentions", TL_ENTITY_MASK_MENTION },
+    { "hashtags", TL_ENTITY_MASK_HASHTAG },
+  };
+  GString *text = g_string_new (NULL);
+  guint i;
+
+  while (text->len < 64 * 1024) {
+    g_string_append (text, ascii_text);
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (masks); i ++) {
+    gsize n_calls = 0;
+    gint64 start, elapsed;
+
+    start = g_get_monotonic_time ();
+    do {
+      gsize n_entities;
+      TlEntity *entities = tl_extract_entities_masked_n (text->str, text->len, masks[i].mask, &n_entities);
+
+      g_free (entities);
+      n_calls ++;
+      elapsed = g_get_monotonic_time () - start;
+    } while (elapsed < BENCHMARK_SECONDS * G_USEC_PER_SEC);
+
+    printf ("entity-mask %s: %.1f MB/s (%.2f us per call)\n",
+            masks[i].name,
+            (double)(text->len * n_calls) / elapsed,
+            (double)elapsed / n_calls);
+  }
+
+  g_string_free (text, TRUE);
+}
+
+static void
+bench_count_all (void)
+{
+  gsize n_calls = 0, n_separate_calls = 0;
+  gint64 start, elapsed, separate_elapsed;
+
+  start = g_get_monotonic_time ();
+  do {
+    TlCounts counts;
+
+    tl_count_all (ascii_text, strlen (ascii_text), &counts);
+    n_calls ++;
+    elapsed = g_get_monotonic_time () - start;
+  } while (elapsed < BENCHMARK_SECONDS * G_USEC_PER_SEC);
+
+  start = g_get_monotonic_time ();
+  do {
+    tl_count_characters (ascii_text);
+    tl_count_weighted_characters (ascii_text, COUNT_BASIC);
+    tl_count_weighted_characters (ascii_text, COUNT_SHORT_URLS);
+    tl_count_weighted_characters (ascii_text, COUNT_COMPACT);
+    n_separate_calls ++;
+    separate_elapsed = g_get_monotonic_time () - start;
+  } while (separate_elapsed < BENCHMARK_SECONDS * G_USEC_PER_SEC);
+
+  printf ("count-all: %.2f us per call, %.2f us for four separate counts\n",
+          (double)elapsed / n_calls,
+          (double)separate_elapsed / n_separate_calls);
+}
+
+static void
+bench_utf16 (void)
+{
+  gsize n_calls = 0, n_transcoded_calls = 0;
+  gint64 start, elapsed, transcoded_elapsed;
+  glong length_in_units;
+  gunichar2 *input = g_utf8_to_utf16 (ascii_text, -1, NULL, &length_in_units, NULL);
+
+  start = g_get_monotonic_time ();
+  do {
+    tl_count_weighted_characters_utf16 (input, length_in_units, COUNT_SHORT_URLS);
+    n_calls ++;
+    elapsed = g_get_monotonic_time () - start;
+  } while (elapsed < BENCHMARK_SECONDS * G_USEC_PER_SEC);
+
+  start = g_get_monotonic_time ();
+  do {
+    glong length_in_bytes;
+    char *text = g_utf16_to_utf8 (input, length_in_units, NULL, &length_in_bytes, NULL);
+
+    tl_count_weighted_characters_n (text, length_in_bytes, FALSE);
+    g_free (text);
+    n_transcoded_calls ++;
+    transcoded_elapsed = g_get_monotonic_time () - start;
+  } while (transcoded_elapsed < BENCHMARK_SECONDS * G_USEC_PER_SEC);
+
+  printf ("utf16: %.2f us per call, %.2f us converting to UTF-8 first\n",
+          (double)elapsed / n_calls,
+          (double)transcoded_elapsed / n_transcoded_calls);
+
+  g_free (input);
+}
+
+int
+main (void)
+{
+  bench_tld_probes ();
+  bench_ascii_text ();
+  bench_long_text ();
+  bench_entity_mask ();
+  bench_count_all ();
+  bench_utf16 ();
+
+  return 0;
+}
@@ -16,6 +16,7 @@
  */
 
 #include "libtweetlength.h"
+#include <string.h>
 
 static void
 empty (void)
@@ -1059,6 +1060,579 @@ and_text (void)
   g_free (entities);
 }
 
+static void
+context (void)
+{
+  const char *texts[] = {
+    "",
+    "fobar @corebi ",
+    "a #hashtag and a link: http://example.com/path?q=(1)",
+    "á ó ö",
+    "no entities here",
+    "@a @b @c @d @e @f #g #h http://i.com j.org",
+  };
+  TlContext *context = tl_context_new ();
+  guint round;
+
+  // Go through the texts twice so the context gets reused with both
+  // shorter and longer inputs than it has already seen.
+  for (round = 0; round < 2; round ++) {
+    guint i;
+
+    for (i = 0; i < G_N_ELEMENTS (texts); i ++) {
+      gsize n_expected, n_entities;
+      gsize expected_length, text_length;
+      TlEntity *expected;
+      const TlEntity *entities;
+      guint k;
+
+      expected = tl_extract_entities_and_text (texts[i], &n_expected, &expected_length);
+      entities = tl_extract_entities_and_text_ctx (context, texts[i], &n_entities, &text_length);
+      g_assert_cmpint (n_entities, ==, n_expected);
+      g_assert_cmpint (text_length, ==, expected_length);
+      for (k = 0; k < n_entities; k ++) {
+        g_assert_cmpint (entities[k].type, ==, expected[k].type);
+        g_assert (entities[k].start == expected[k].start);
+        g_assert_cmpint (entities[k].length_in_bytes, ==, expected[k].length_in_bytes);
+        g_assert_cmpint (entities[k].start_character_index, ==, expected[k].start_character_index);
+      }
+      g_free (expected);
+
+      expected = tl_extract_entities (texts[i], &n_expected, NULL);
+      entities = tl_extract_entities_ctx (context, texts[i], &n_entities, NULL);
+      g_assert_cmpint (n_entities, ==, n_expected);
+      for (k = 0; k < n_entities; k ++) {
+        g_assert_cmpint (entities[k].type, ==, expected[k].type);
+        g_assert (entities[k].start == expected[k].start);
+      }
+      g_free (expected);
+
+      g_assert_cmpint (tl_count_characters_ctx (context, texts[i]), ==,
+                       tl_count_characters (texts[i]));
+      g_assert_cmpint (tl_count_weighted_characters_ctx (context, texts[i], COUNT_COMPACT), ==,
+                       tl_count_weighted_characters (texts[i], COUNT_COMPACT));
+    }
+  }
+
+  tl_context_free (context);
+}
+
+static void
+long_input (void)
+{
+  GString *piece = g_string_new ("go to example.com/");
+  GString *text = g_string_new (NULL);
+  gsize n_piece_entities, n_entities;
+  gsize piece_length, text_length;
+  TlEntity *piece_entities;
+  TlEntity *entities;
+  guint i;
+
+  // A link much longer than the window the tokens are parsed in
+  for (i = 0; i < 300; i ++) {
+    g_string_append (piece, "a-");
+  }
+  g_string_append (piece, " then @someone #tag");
+
+  for (i = 0; i < 50; i ++) {
+    if (i > 0) {
+      g_string_append_c (text, ' ');
+    }
+    g_string_append (text, piece->str);
+  }
+
+  piece_entities = tl_extract_entities_and_text (piece->str, &n_piece_entities, &piece_length);
+  g_assert_cmpint (n_piece_entities, ==, 6);
+  g_assert_cmpint (piece_entities[2].type, ==, TL_ENT_LINK);
+  g_assert_cmpint (piece_entities[2].length_in_bytes, ==, 12 + 600);
+
+  entities = tl_extract_entities_and_text (text->str, &n_entities, &text_length);
+  g_assert_cmpint (n_entities, ==, 50 * n_piece_entities);
+  g_assert_cmpint (text_length, ==, 50 * piece_length + 49);
+
+  for (i = 0; i < n_entities; i ++) {
+    const TlEntity *e = &piece_entities[i % n_piece_entities];
+    const gsize offset = (i / n_piece_entities) * (piece->len + 1);
+
+    g_assert_cmpint (entities[i].type, ==, e->type);
+    g_assert_cmpint (entities[i].start - text->str, ==, e->start - piece->str + offset);
+    g_assert_cmpint (entities[i].length_in_bytes, ==, e->length_in_bytes);
+    g_assert_cmpint (entities[i].start_character_index, ==, e->start_character_index + offset);
+  }
+
+  g_free (entities);
+  g_free (piece_entities);
+  g_string_free (text, TRUE);
+  g_string_free (piece, TRUE);
+}
+
+static void
+describe_entity (const TlEntity *e,
+                 gpointer        user_data)
+{
+  GString *str = user_data;
+
+  g_string_append_printf (str, "%u %u %u+%u %u %.*s|", e->type, (guint)e->start_character_index,
+                          (guint)e->start_utf16_index, (guint)e->length_in_utf16_units,
+                          (guint)e->length_in_weighted_characters, (int)e->length_in_bytes, e->start);
+}
+
+static void
+stream (void)
+{
+  const char *texts[] = {
+    "",
+    "fobar @corebi ",
+    "a #hashtag and a link: http://example.com/path?q=(1) and (foo.com/bar)",
+    "🤦🏼‍♂️ ZWJ 👨‍👩‍👧‍👦 and ü in words, @über #tag!",
+    "  leading and trailing whitespace  ",
+    "no entities here",
+    // Not in NFC
+    "cafe\xcc\x81 #cafe\xcc\x81 \xe1\x84\x80\xe1\x85\xa1 👨‍👩‍👧‍👦",
+  };
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (texts); i ++) {
+    const gsize len = strlen (texts[i]);
+    GString *expected = g_string_new (NULL);
+    gsize n_entities, text_length;
+    TlEntity *entities;
+    gsize split;
+    guint k;
+
+    entities = tl_extract_entities_and_text (texts[i], &n_entities, &text_length);
+    for (k = 0; k < n_entities; k ++) {
+      describe_entity (&entities[k], expected);
+    }
+    g_free (entities);
+
+    // Every split into two pieces, and one byte at a time
+    for (split = 0; split <= len + 1; split ++) {
+      GString *found = g_string_new (NULL);
+      TlStream *stream = tl_stream_new (COUNT_COMPACT, TRUE, describe_entity, found);
+
+      if (split <= len) {
+        tl_stream_feed (stream, texts[i], split);
+        tl_stream_feed (stream, texts[i] + split, len - split);
+      } else {
+        for (k = 0; k < len; k ++) {
+          tl_stream_feed (stream, texts[i] + k, 1);
+        }
+      }
+      tl_stream_finish (stream);
+
+      g_assert_cmpstr (found->str, ==, expected->str);
+      g_assert_cmpint (tl_stream_get_length (stream), ==, text_length);
+      g_assert_cmpint (tl_stream_get_weighted_length (stream), ==,
+                       tl_count_weighted_characters (texts[i], COUNT_COMPACT));
+
+      tl_stream_free (stream);
+      g_string_free (found, TRUE);
+    }
+
+    g_string_free (expected, TRUE);
+  }
+}
+
+static void
+foreach (void)
+{
+  GString *many = g_string_new (NULL);
+  const char *texts[] = {
+    "",
+    "fobar @corebi ",
+    "a #hashtag and a link: http://example.com/path?q=(1) and (foo.com/bar)",
+    "@a @b @c @d @e @f @g @h @i @j @k @l @m @n @o @p @q @r @s @t #u #v #w x.co y.co",
+    // Words with more entities than the iterator buffers
+    "a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z @x,@y,#z,a.co,@b#c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t",
+    NULL,
+  };
+  // Empty, like for tl_extract_entities_n()
+  const char nul_text[] = "\0 @foo #bar";
+  GString *nul_found = g_string_new (NULL);
+  TlEntityIter nul_iter;
+  TlEntity nul_entity;
+  guint i;
+
+  // More entities than the iterator buffers, in more than one segment
+  for (i = 0; i < 400; i ++) {
+    g_string_append (many, "tèxt @user #tag a.co/@b ");
+  }
+  texts[G_N_ELEMENTS (texts) - 1] = many->str;
+
+  for (i = 0; i < G_N_ELEMENTS (texts); i ++) {
+    guint flags;
+
+    for (flags = TL_EXTRACT_DEFAULT; flags <= TL_EXTRACT_TEXT; flags ++) {
+      const gsize len = strlen (texts[i]);
+      GString *expected = g_string_new (NULL);
+      GString *found = g_string_new (NULL);
+      TlEntityIter iter;
+      TlEntity e;
+      gsize n_entities;
+      TlEntity *entities;
+      guint k;
+
+      if (flags & TL_EXTRACT_TEXT) {
+        entities = tl_extract_entities_and_text_n (texts[i], len, &n_entities, NULL);
+      } else {
+        entities = tl_extract_entities_n (texts[i], len, &n_entities, NULL);
+      }
+      for (k = 0; k < n_entities; k ++) {
+        describe_entity (&entities[k], expected);
+      }
+      g_free (entities);
+
+      tl_foreach_entity (texts[i], len, flags, describe_entity, found);
+      g_assert_cmpstr (found->str, ==, expected->str);
+
+      g_string_truncate (found, 0);
+      tl_entity_iter_init (&iter, texts[i], len, flags);
+      while (tl_entity_iter_next (&iter, &e)) {
+        describe_entity (&e, found);
+      }
+      g_assert_cmpstr (found->str, ==, expected->str);
+      g_assert_false (tl_entity_iter_next (&iter, &e));
+
+      g_string_free (expected, TRUE);
+      g_string_free (found, TRUE);
+    }
+  }
+
+  tl_foreach_entity (nul_text, sizeof (nul_text) - 1, TL_EXTRACT_TEXT, describe_entity, nul_found);
+  g_assert_cmpstr (nul_found->str, ==, "");
+  tl_entity_iter_init (&nul_iter, nul_text, sizeof (nul_text) - 1, TL_EXTRACT_TEXT);
+  g_assert_false (tl_entity_iter_next (&nul_iter, &nul_entity));
+
+  g_string_free (nul_found, TRUE);
+  g_string_free (many, TRUE);
+}
+
+static void
+into (void)
+{
+  const char *text = "@a #b c.com then @d and #e";
+  TlEntity buffer[64];
+  gsize n_expected, n_written, n_needed;
+  TlEntity *expected;
+  guint k;
+
+  expected = tl_extract_entities (text, &n_expected, NULL);
+  g_assert_cmpint (n_expected, ==, 5);
+
+  g_assert_true (tl_extract_entities_into (text, strlen (text), buffer, G_N_ELEMENTS (buffer),
+                                           &n_written, &n_needed));
+  g_assert_cmpint (n_written, ==, n_expected);
+  g_assert_cmpint (n_needed, ==, n_expected);
+  for (k = 0; k < n_written; k ++) {
+    g_assert_cmpint (buffer[k].type, ==, expected[k].type);
+    g_assert (buffer[k].start == expected[k].start);
+    g_assert_cmpint (buffer[k].length_in_bytes, ==, expected[k].length_in_bytes);
+    g_assert_cmpint (buffer[k].start_character_index, ==, expected[k].start_character_index);
+  }
+
+  // Too small, only the first ones get written
+  g_assert_false (tl_extract_entities_into (text, strlen (text), buffer, 2, &n_written, &n_needed));
+  g_assert_cmpint (n_written, ==, 2);
+  g_assert_cmpint (n_needed, ==, n_expected);
+  g_assert (buffer[1].start == expected[1].start);
+
+  g_assert_false (tl_extract_entities_into (text, strlen (text), NULL, 0, &n_written, &n_needed));
+  g_assert_cmpint (n_written, ==, 0);
+  g_assert_cmpint (n_needed, ==, n_expected);
+
+  g_assert_true (tl_extract_entities_into ("", 0, NULL, 0, &n_written, &n_needed));
+  g_assert_cmpint (n_needed, ==, 0);
+
+  // Empty, like for tl_extract_entities_n()
+  g_assert_true (tl_extract_entities_into ("\0 @foo #bar", 11, buffer, G_N_ELEMENTS (buffer), &n_written, &n_needed));
+  g_assert_cmpint (n_needed, ==, 0);
+
+  g_free (expected);
+}
+
+static void
+masked (void)
+{
+  const char *texts[] = {
+    "",
+    "fobar @corebi ",
+    "a #hashtag and a link: http://example.com/path?q=(1) and (foo.com/bar)",
+    "links swallow a.co/@mention and b.co/#hashtag, @c.com is a mention",
+    "ünïcödé\u3000@user\u3000#tag x.co\u3000 and @a@b #c#d",
+    "no entities here",
+  };
+  gsize n_nul_entities;
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (texts); i ++) {
+    const gsize len = strlen (texts[i]);
+    gsize n_all;
+    TlEntity *all = tl_extract_entities_and_text_n (texts[i], len, &n_all, NULL);
+    guint mask;
+
+    for (mask = 0; mask < 1 << (TL_ENT_MENTION + 1); mask += 2) {
+      GString *expected = g_string_new (NULL);
+      GString *found = g_string_new (NULL);
+      gsize n_entities;
+      TlEntity *entities = tl_extract_entities_masked_n (texts[i], len, mask, &n_entities);
+      guint k;
+
+      for (k = 0; k < n_all; k ++) {
+        if (mask & (1 << all[k].type)) {
+          describe_entity (&all[k], expected);
+        }
+      }
+      for (k = 0; k < n_entities; k ++) {
+        describe_entity (&entities[k], found);
+      }
+
+      g_assert_cmpstr (found->str, ==, expected->str);
+      if (n_entities == 0) {
+        g_assert_null (entities);
+      }
+
+      g_free (entities);
+      g_string_free (expected, TRUE);
+      g_string_free (found, TRUE);
+    }
+
+    g_free (all);
+  }
+
+  // Empty, like for tl_extract_entities_n()
+  g_assert_null (tl_extract_entities_masked_n ("\0 @foo #bar", 11, TL_ENTITY_MASK_TEXT | TL_ENTITY_MASK_MENTION,
+                                               &n_nul_entities));
+  g_assert_cmpint (n_nul_entities, ==, 0);
+  g_assert_null (tl_extract_entities_masked_n ("\0 @foo #bar", 11, TL_ENTITY_MASK_MENTION, &n_nul_entities));
+  g_assert_cmpint (n_nul_entities, ==, 0);
+}
+
+static void
+batch (void)
+{
+  const char *samples[] = {
+    "",
+    "fobar @corebi ",
+    "a #hashtag and a link: http://example.com/path?q=(1)",
+    "no entities here",
+    "@a @b @c #d e.co",
+  };
+  const guint thread_counts[] = { 1, 3, 0 };
+  const gsize n_texts = 1000;
+  TlText *texts = g_new (TlText, n_texts);
+  gsize *offsets = g_new (gsize, n_texts + 1);
+  gsize *text_lengths = g_new (gsize, n_texts);
+  guint i, t;
+
+  for (i = 0; i < n_texts; i ++) {
+    texts[i].input = samples[(i * 7) % G_N_ELEMENTS (samples)];
+    texts[i].length_in_bytes = strlen (texts[i].input);
+  }
+
+  for (t = 0; t < G_N_ELEMENTS (thread_counts); t ++) {
+    TlEntity *entities = tl_extract_entities_batch (texts, n_texts, TL_EXTRACT_TEXT, thread_counts[t],
+                                                    offsets, text_lengths);
+
+    g_assert_cmpint (offsets[0], ==, 0);
+    for (i = 0; i < n_texts; i ++) {
+      gsize n_expected, expected_length;
+      TlEntity *expected = tl_extract_entities_and_text (texts[i].input, &n_expected, &expected_length);
+      guint k;
+
+      g_assert_cmpint (offsets[i + 1] - offsets[i], ==, n_expected);
+      g_assert_cmpint (text_lengths[i], ==, expected_length);
+      for (k = 0; k < n_expected; k ++) {
+        const TlEntity *e = &entities[offsets[i] + k];
+
+        g_assert_cmpint (e->type, ==, expected[k].type);
+        g_assert (e->start == expected[k].start);
+        g_assert_cmpint (e->start_character_index, ==, expected[k].start_character_index);
+      }
+      g_free (expected);
+    }
+
+    g_free (entities);
+  }
+
+  g_free (text_lengths);
+  g_free (offsets);
+  g_free (texts);
+}
+
+static void
+document (void)
+{
+  const char *texts[] = {
+    "",
+    "fobar @corebi ",
+    "a #hashtag and a link: http://example.com/path?q=(1) and (foo.com/bar)",
+    "ünïcödé\u3000@user\u3000#tag x.co\u3000 and @a@b #c#d 👩\u200d💼",
+    "no entities here",
+    // Not in NFC
+    "cafe\xcc\x81 #cafe\xcc\x81 example.com/e\xcc\x81 🤦🏼\u200d♂️",
+  };
+  const guint count_modes[] = { COUNT_BASIC, COUNT_SHORT_URLS, COUNT_COMPACT };
+  guint i, m;
+
+  for (i = 0; i < G_N_ELEMENTS (texts); i ++) {
+    const gsize len = strlen (texts[i]);
+    TlDocument *document = tl_document_new (texts[i], len);
+    char *normalized = g_utf8_normalize (texts[i], len, G_NORMALIZE_DEFAULT_COMPOSE);
+    guint flags;
+
+    // Twice, the second time from what the document kept
+    for (flags = 0; flags < 4; flags ++) {
+      GString *expected = g_string_new (NULL);
+      GString *found = g_string_new (NULL);
+      gsize n_expected, n_entities, expected_text_length, text_length;
+      TlEntity *expected_entities;
+      const TlEntity *entities;
+      guint k;
+
+      if (flags & TL_EXTRACT_TEXT) {
+        expected_entities = tl_extract_entities_and_text_n (texts[i], len, &n_expected, &expected_text_length);
+      } else {
+        expected_entities = tl_extract_entities_n (texts[i], len, &n_expected, &expected_text_length);
+      }
+      entities = tl_document_get_entities (document, flags & TL_EXTRACT_TEXT, &n_entities, &text_length);
+
+      for (k = 0; k < n_expected; k ++) {
+        describe_entity (&expected_entities[k], expected);
+      }
+      for (k = 0; k < n_entities; k ++) {
+        describe_entity (&entities[k], found);
+      }
+
+      g_assert_cmpstr (found->str, ==, expected->str);
+      g_assert_cmpint (text_length, ==, expected_text_length);
+
+      g_free (expected_entities);
+      g_string_free (expected, TRUE);
+      g_string_free (found, TRUE);
+    }
+
+    g_assert_cmpint (tl_document_get_length (document), ==, tl_count_characters (texts[i]));
+
+    for (m = 0; m < G_N_ELEMENTS (count_modes); m ++) {
+      TlPositionIndex *index = tl_document_get_position_index (document, count_modes[m]);
+      TlPositionIndex *expected_index = tl_position_index_new (texts[i], len, count_modes[m]);
+      gsize offset;
+
+      g_assert_cmpint (tl_document_get_weighted_length (document, count_modes[m]), ==,
+                       tl_count_weighted_characters (texts[i], count_modes[m]));
+      for (offset = 0; offset <= len; offset ++) {
+        g_assert_cmpint (tl_position_index_get_weighted_length (index, 0, offset), ==,
+                         tl_position_index_get_weighted_length (expected_index, 0, offset));
+        g_assert_cmpint (tl_position_index_get_character_for_byte_offset (index, offset), ==,
+                         tl_position_index_get_character_for_byte_offset (expected_index, offset));
+      }
+      // The index counts the text as it is
+      if (strcmp (normalized, texts[i]) == 0) {
+        g_assert_cmpint (tl_position_index_get_weighted_length (index, 0, len), ==,
+                         tl_count_weighted_characters (texts[i], count_modes[m]));
+      }
+      g_assert_true (tl_document_get_position_index (document, count_modes[m]) == index);
+
+      tl_position_index_free (expected_index);
+    }
+
+    g_free (normalized);
+    tl_document_free (document);
+  }
+}
+
+static void
+utf16_offsets (void)
+{
+  const char *texts[] = {
+    "fobar @corebi ",
+    "😀 @user #tag 😀😀 example.com/😀 x",
+    "𝒳𝒴 #𝒵tag @abc\u3000https://a.co/b 👩\u200d💼 日本語 #日本",
+  };
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (texts); i ++) {
+    gsize n_entities;
+    TlEntity *entities = tl_extract_entities_and_text (texts[i], &n_entities, NULL);
+    guint k;
+
+    g_assert_cmpint (n_entities, >, 0);
+
+    for (k = 0; k < n_entities; k ++) {
+      glong start, length;
+      gunichar2 *utf16;
+
+      utf16 = g_utf8_to_utf16 (texts[i], entities[k].start - texts[i], NULL, &start, NULL);
+      g_free (utf16);
+      utf16 = g_utf8_to_utf16 (entities[k].start, entities[k].length_in_bytes, NULL, &length, NULL);
+      g_free (utf16);
+
+      g_assert_cmpint (entities[k].start_utf16_index, ==, start);
+      g_assert_cmpint (entities[k].length_in_utf16_units, ==, length);
+    }
+
+    g_free (entities);
+  }
+}
+
+static void
+utf16_input (void)
+{
+  const char *texts[] = {
+    "",
+    "fobar @corebi ",
+    "😀 @user #tag 😀😀 example.com/😀 x",
+    "𝒳𝒴 #𝒵tag @abc\u3000https://a.co/b 👩\u200d💼 日本語 #日本",
+  };
+  GString *long_text = g_string_new (NULL);
+  guint i;
+
+  for (i = 0; i < 200; i ++) {
+    g_string_append (long_text, i % 150 == 0 ? "@user😀#tag " : "😀a.co/#x");
+  }
+
+  for (i = 0; i <= G_N_ELEMENTS (texts); i ++) {
+    const char *text = i < G_N_ELEMENTS (texts) ? texts[i] : long_text->str;
+    glong length_in_units;
+    gunichar2 *input = g_utf8_to_utf16 (text, -1, NULL, &length_in_units, NULL);
+    guint flags;
+
+    for (flags = 0; flags <= TL_EXTRACT_TEXT; flags ++) {
+      gsize n_expected, n_entities, expected_text_length, text_length;
+      TlEntity *expected;
+      TlEntity *entities;
+      guint k;
+
+      if (flags & TL_EXTRACT_TEXT) {
+        expected = tl_extract_entities_and_text (text, &n_expected, &expected_text_length);
+      } else {
+        expected = tl_extract_entities (text, &n_expected, &expected_text_length);
+      }
+      entities = tl_extract_entities_utf16 (input, length_in_units, flags, &n_entities, &text_length);
+
+      g_assert_cmpint (n_entities, ==, n_expected);
+      g_assert_cmpint (text_length, ==, expected_text_length);
+
+      for (k = 0; k < n_entities; k ++) {
+        g_assert_null (entities[k].start);
+        g_assert_cmpint (entities[k].type, ==, expected[k].type);
+        g_assert_cmpint (entities[k].start_character_index, ==, expected[k].start_character_index);
+        g_assert_cmpint (entities[k].length_in_characters, ==, expected[k].length_in_characters);
+        g_assert_cmpint (entities[k].start_utf16_index, ==, expected[k].start_utf16_index);
+        g_assert_cmpint (entities[k].length_in_utf16_units, ==, expected[k].length_in_utf16_units);
+      }
+
+      g_free (expected);
+      g_free (entities);
+    }
+
+    g_free (input);
+  }
+
+  g_string_free (long_text, TRUE);
+}
+
 int
 main (int argc, char **argv)
 {
@@ -1077,6 +1651,16 @@ main (int argc, char **argv)
   g_test_add_func ("/entities/combined", combined);
   g_test_add_func ("/entities/link-conformance1", link_conformance1);
   g_test_add_func ("/entities/and-text", and_text);
+  g_test_add_func ("/entities/context", context);
+  g_test_add_func ("/entities/long-input", long_input);
+  g_test_add_func ("/entities/stream", stream);
+  g_test_add_func ("/entities/foreach", foreach);
+  g_test_add_func ("/entities/into", into);
+  g_test_add_func ("/entities/masked", masked);
+  g_test_add_func ("/entities/batch", batch);
+  g_test_add_func ("/entities/document", document);
+  g_test_add_func ("/entities/utf16-offsets", utf16_offsets);
+  g_test_add_func ("/entities/utf16-input", utf16_input);
 
   return g_test_run ();
 }
@@ -17,6 +17,7 @@
 
 #include "libtweetlength.h"
 #include "../src/data.h"
+#include <string.h>
 
 static void
 empty (void)
@@ -149,6 +150,26 @@ utf8 (void)
   g_assert_cmpint (tl_count_weighted_characters ("のののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののののの", TRUE), ==, 280);
 }
 
+static void
+normalization (void)
+{
+  // Decomposed text counts the same as composed text, whichever function it goes through
+  const char *decomposed = "Cafe\u0301 #cafe\u0301 http://cafe\u0301.com/ a\u0308";
+  const char *composed = "Caf\u00E9 #caf\u00E9 http://caf\u00E9.com/ \u00E4";
+
+  g_assert_cmpint (tl_count_weighted_characters (decomposed, COUNT_BASIC), ==, tl_count_weighted_characters (composed, COUNT_BASIC));
+  g_assert_cmpint (tl_count_weighted_characters (decomposed, COUNT_SHORT_URLS), ==, tl_count_weighted_characters (composed, COUNT_SHORT_URLS));
+  g_assert_cmpint (tl_count_weighted_characters (decomposed, COUNT_COMPACT), ==, 5 + 6 + 23 + 2);
+  g_assert_cmpint (tl_count_weighted_characters_n (decomposed, strlen (decomposed), FALSE), ==, 5 + 6 + 23 + 2);
+  g_assert_cmpint (tl_count_weighted_characters_n (decomposed, strlen (decomposed), TRUE), ==, 5 + 6 + 23 + 2);
+  g_assert_cmpint (tl_count_weighted_characters_n ("e\u0301", 3, TRUE), ==, 1);
+
+  // Hangul jamo compose into a single syllable
+  g_assert_cmpint (tl_count_weighted_characters ("\u1112\u1161\u11AB", COUNT_COMPACT), ==, 2);
+  // Singleton decompositions don't need anything to compose with, U+212B ANGSTROM SIGN becomes U+00C5
+  g_assert_cmpint (tl_count_weighted_characters ("\u212B", COUNT_COMPACT), ==, 1);
+}
+
 static void
 validate (void)
 {
@@ -240,25 +261,461 @@ cawbird_bug_114 (void)
   g_assert_cmpint (tl_count_weighted_characters ("\U0001F468", COUNT_COMPACT), ==, 2); // Default yellow man
 }
 
+static void
+long_dotted_runs (void)
+{
+  // Long dotted runs used to be scanned again from every token in them
+  const gsize n_repeats = 5000;
+  char *text = g_malloc (n_repeats * 3 + 4);
+  gsize i;
+
+  for (i = 0; i < n_repeats; i ++) {
+    memcpy (text + (i * 3), "a1.", 3);
+  }
+  text[n_repeats * 3] = '\0';
+  g_assert_cmpint (tl_count_characters (text), ==, n_repeats * 3);
+
+  // The same run is a single link once it ends in a TLD
+  memcpy (text + (n_repeats * 3), "com", 4);
+  g_assert_cmpint (tl_count_characters (text), ==, 23);
+
+  // ... unless one of the host fragments is too long
+  memset (text + (n_repeats * 3) - 65, 'a', 64);
+  g_assert_cmpint (tl_count_characters (text), ==, n_repeats * 3 + 3);
+
+  g_free (text);
+}
+
+static void
+long_text (void)
+{
+  // Counting only looks at a window of tokens at a time, so check texts spanning lots of them
+  const char *unit = "word http://example.com/path?q=(1) @user #tag ";
+  const gsize n_repeats = 1000;
+  const gsize unit_length = strlen (unit);
+  const gsize unit_count = tl_count_characters (unit);
+  char *text = g_malloc (n_repeats * unit_length + 1);
+  gsize i;
+
+  g_assert_cmpint (unit_count, ==, 5 + 23 + 1 + 6 + 5);
+
+  for (i = 0; i < n_repeats; i ++) {
+    memcpy (text + (i * unit_length), unit, unit_length);
+  }
+  text[n_repeats * unit_length] = '\0';
+
+  g_assert_cmpint (tl_count_characters (text), ==, n_repeats * unit_count);
+  g_assert_cmpint (tl_count_weighted_characters (text, COUNT_COMPACT), ==, n_repeats * unit_count);
+
+  g_free (text);
+}
+
+static void
+tld_table (void)
+{
+  gsize length;
+  gsize i;
+
+  // token_is_tld() binary searches the TLDs of each length, so they must be sorted
+  g_assert_cmpint (TLD_OFFSETS[G_N_ELEMENTS (TLD_OFFSETS) - 1], ==, G_N_ELEMENTS (TLDS));
+
+  for (length = 0; length < G_N_ELEMENTS (TLD_OFFSETS) - 1; length ++) {
+    for (i = TLD_OFFSETS[length]; i < TLD_OFFSETS[length + 1]; i ++) {
+      g_assert_cmpint (strlen (TLDS[i]), ==, length);
+
+      if (i > TLD_OFFSETS[length]) {
+        g_assert_cmpint (strcmp (TLDS[i - 1], TLDS[i]), <, 0);
+      }
+    }
+  }
+
+  g_assert_cmpint (tl_count_characters ("example.COM"), ==, 23);
+  g_assert_cmpint (tl_count_characters ("example.comm"), ==, 12);
+  g_assert_cmpint (tl_count_characters ("example.co"), ==, 23);
+  g_assert_cmpint (tl_count_characters ("example.c"), ==, 9);
+  g_assert_cmpint (tl_count_characters ("example.삼성"), ==, 23);
+  g_assert_cmpint (tl_count_characters ("example.コム"), ==, 23);
+  g_assert_cmpint (tl_count_characters ("example.コ"), ==, 9);
+}
+
+#define N_CONCURRENT_THREADS 8
+
+static const char *concurrent_text = "\U0001F1EC\U0001F1E7 \U0001F468\u200D\U0001F468\u200D\U0001F466 "
+                                     "\U0001F3F4\u200D\u2620\uFE0F #hashtag @mention example.com";
+static volatile gint concurrent_start = 0;
+
+static gpointer
+concurrent_count (gpointer user_data)
+{
+  gsize *results = user_data;
+
+  while (g_atomic_int_get (&concurrent_start) == 0) {
+    // Spin so that all threads make their first call together
+  }
+
+  results[0] = tl_count_weighted_characters (concurrent_text, COUNT_COMPACT);
+  results[1] = tl_count_characters (concurrent_text);
+
+  return NULL;
+}
+
+static void
+concurrent_first_calls (void)
+{
+  // All lookup data is static and const, so there is nothing for the first calls to race on.
+  // This test has to run before any other call into the library.
+  GThread *threads[N_CONCURRENT_THREADS];
+  gsize results[N_CONCURRENT_THREADS][2];
+  guint i;
+
+  for (i = 0; i < N_CONCURRENT_THREADS; i ++) {
+    threads[i] = g_thread_new ("concurrent-count", concurrent_count, results[i]);
+  }
+  g_atomic_int_set (&concurrent_start, 1);
+
+  for (i = 0; i < N_CONCURRENT_THREADS; i ++) {
+    g_thread_join (threads[i]);
+    g_assert_cmpint (results[i][0], ==, 50);
+    g_assert_cmpint (results[i][1], ==, 55);
+  }
+}
+
+static void
+fits_within (void)
+{
+  const char *text = "Hello @user, see https://example.com/path for #details \U0001F468\u200D\U0001F469\u200D\U0001F467";
+  const gsize length = strlen (text);
+  const gsize total = tl_count_weighted_characters (text, COUNT_COMPACT);
+  char *blob;
+
+  g_assert_true (tl_fits_within (text, length, total, COUNT_COMPACT));
+  g_assert_false (tl_fits_within (text, length, total - 1, COUNT_COMPACT));
+  g_assert_true (tl_fits_within ("", 0, 0, COUNT_COMPACT));
+  // Short texts are accepted without counting, but links still count as 23
+  g_assert_false (tl_fits_within ("a.co", 4, 8, COUNT_COMPACT));
+  g_assert_true (tl_fits_within ("a.co", 4, 8, COUNT_BASIC));
+
+  blob = g_malloc (100000 + 1);
+  memset (blob, 'a', 100000);
+  memset (blob, ' ', 100000 / 2);
+  blob[100000] = '\0';
+  g_assert_false (tl_fits_within (blob, 100000, 280, COUNT_COMPACT));
+  g_assert_true (tl_fits_within (blob, 100000, 100000, COUNT_COMPACT));
+  g_free (blob);
+}
+
+static void
+truncation_offset (void)
+{
+  const char *text = "Hi @someone #tag https://example.com/ \U0001F468\u200D\U0001F469\u200D\U0001F467 end";
+  const gsize length = strlen (text);
+
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 280, COUNT_COMPACT), ==, length);
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 0, COUNT_COMPACT), ==, 0);
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 2, COUNT_COMPACT), ==, 2);
+  // Mentions, hashtags and links are never cut
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 8, COUNT_COMPACT), ==, 3);
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 14, COUNT_COMPACT), ==, 12);
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 30, COUNT_COMPACT), ==, 17);
+  // Neither are emoji sequences, even when they aren't counted as one character
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 42, COUNT_COMPACT), ==, 38);
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 43, COUNT_COMPACT), ==, 56);
+  g_assert_cmpint (tl_find_truncation_offset (text, length, 45, COUNT_SHORT_URLS), ==, 38);
+  // Text is cut between characters
+  g_assert_cmpint (tl_find_truncation_offset ("\u706B\u706B\u706B", 9, 5, COUNT_COMPACT), ==, 6);
+  // Cutting text after a dot short could turn it into a TLD
+  g_assert_cmpint (tl_find_truncation_offset ("ab.cdx", 6, 5, COUNT_COMPACT), ==, 3);
+  // "ab.cd" followed by an @ is not a link, but it is on its own
+  g_assert_cmpint (tl_find_truncation_offset ("ab.cd@ x", 8, 6, COUNT_COMPACT), ==, 6);
+  g_assert_cmpint (tl_find_truncation_offset ("ab.cd@ x", 8, 5, COUNT_COMPACT), ==, 0);
+}
+
+static void
+plain_text (void)
+{
+  // Nothing in here can start an entity. The keycap's digit is a token of its own,
+  // so it is not compacted, unlike the family.
+  const char *text = "plain words, 1\uFE0F\u20E3 and \U0001F469\u200D\U0001F469\u200D\U0001F467 but no entities";
+  const char *mixed = "plain words then a.co and @user #tag";
+  gsize n_entities, text_length;
+  TlEntity *entities;
+
+  g_assert_cmpint (tl_count_characters (text), ==, 42);
+  g_assert_cmpint (tl_count_weighted_characters (text, COUNT_BASIC), ==, 47);
+  g_assert_cmpint (tl_count_weighted_characters (text, COUNT_SHORT_URLS), ==, 47);
+  g_assert_cmpint (tl_count_weighted_characters (text, COUNT_COMPACT), ==, 41);
+  g_assert_cmpint (tl_find_truncation_offset (text, strlen (text), 20, COUNT_COMPACT), ==, 22);
+
+  entities = tl_extract_entities (text, &n_entities, &text_length);
+  g_assert_null (entities);
+  g_assert_cmpint (n_entities, ==, 0);
+  g_assert_cmpint (text_length, ==, 42);
+
+  g_assert_cmpint (tl_count_weighted_characters (mixed, COUNT_COMPACT), ==, 55);
+  g_assert_cmpint (tl_find_truncation_offset (mixed, strlen (mixed), 20, COUNT_COMPACT), ==, 17);
+}
+
+static void
+batch (void)
+{
+  const char *samples[] = {
+    "",
+    "plain text",
+    "🤦🏼‍♂️ with a link example.com and #tag",
+    "Café naïve e\u0301",
+  };
+  const guint count_modes[] = { COUNT_BASIC, COUNT_SHORT_URLS, COUNT_COMPACT };
+  const gsize n_texts = 500;
+  TlText *texts = g_new (TlText, n_texts);
+  gsize *counts = g_new (gsize, n_texts);
+  guint i, m;
+
+  for (i = 0; i < n_texts; i ++) {
+    texts[i].input = samples[(i * 3) % G_N_ELEMENTS (samples)];
+    texts[i].length_in_bytes = strlen (texts[i].input);
+  }
+
+  for (m = 0; m < G_N_ELEMENTS (count_modes); m ++) {
+    tl_count_weighted_characters_batch (texts, n_texts, count_modes[m], 4, counts);
+
+    for (i = 0; i < n_texts; i ++) {
+      g_assert_cmpint (counts[i], ==, tl_count_weighted_characters (texts[i].input, count_modes[m]));
+    }
+  }
+
+  g_free (counts);
+  g_free (texts);
+}
+
+static void
+editor (void)
+{
+  const char *pieces[] = {
+    "word ", " ", "@user ", "#tag", "example.com/path ", "🤦🏼‍♂️", "\u200d", "e\u0301", "ü", ".",
+    "https://", "x", "\n", "a.co", "日本語 ",
+  };
+  const guint count_modes[] = { COUNT_BASIC, COUNT_SHORT_URLS, COUNT_COMPACT };
+  guint m;
+
+  for (m = 0; m < G_N_ELEMENTS (count_modes); m ++) {
+    TlEditor *editor = tl_editor_new (count_modes[m]);
+    guint32 seed = 42;
+    guint step;
+
+    for (step = 0; step < 1000; step ++) {
+      const char *text = tl_editor_get_text (editor);
+      const glong n_chars = g_utf8_strlen (text, -1);
+      const char *start, *end;
+      const char *piece;
+      gsize n_all, n_changed;
+      TlEntity *all;
+      const TlEntity *changed;
+      guint k;
+
+      seed = seed * 1103515245 + 12345;
+      start = g_utf8_offset_to_pointer (text, (seed >> 8) % (n_chars + 1));
+      seed = seed * 1103515245 + 12345;
+      // Mostly insert, sometimes delete a few characters
+      end = (seed >> 8) % 4 == 0 ?
+            g_utf8_offset_to_pointer (start, MIN ((seed >> 12) % 6, (guint32)g_utf8_strlen (start, -1))) :
+            start;
+      seed = seed * 1103515245 + 12345;
+      piece = pieces[(seed >> 8) % G_N_ELEMENTS (pieces)];
+
+      tl_editor_apply_edit (editor, start - text, end - start, piece, strlen (piece));
+
+      text = tl_editor_get_text (editor);
+      g_assert_cmpint (tl_editor_get_weighted_length (editor), ==,
+                       tl_count_weighted_characters (text, count_modes[m]));
+      g_assert_cmpint (tl_editor_get_length (editor), ==, tl_count_characters (text));
+
+      // What was counted again matches the entities of the whole text
+      all = tl_extract_entities (text, &n_all, NULL);
+      changed = tl_editor_get_changed_entities (editor, &n_changed);
+      for (k = 0; k < n_changed; k ++) {
+        guint j = 0;
+
+        while (j < n_all && all[j].start != changed[k].start) {
+          j ++;
+        }
+        g_assert_cmpint (j, <, n_all);
+        g_assert_cmpint (all[j].type, ==, changed[k].type);
+        g_assert_cmpint (all[j].length_in_bytes, ==, changed[k].length_in_bytes);
+        g_assert_cmpint (all[j].start_character_index, ==, changed[k].start_character_index);
+        g_assert_cmpint (all[j].start_utf16_index, ==, changed[k].start_utf16_index);
+        g_assert_cmpint (all[j].length_in_weighted_characters, ==, changed[k].length_in_weighted_characters);
+      }
+      g_free (all);
+    }
+
+    tl_editor_free (editor);
+  }
+}
+
+static void
+position_index (void)
+{
+  const char *texts[] = {
+    "",
+    "plain text",
+    "abc example.com/path def",
+    "🤦🏼‍♂️ ZWJ 👨‍👩‍👧‍👦 and Café @user #tag https://a.co/b",
+    "日本語のテキストと a.co",
+  };
+  const guint count_modes[] = { COUNT_BASIC, COUNT_SHORT_URLS, COUNT_COMPACT };
+  TlPositionIndex *index;
+  guint i, m;
+
+  for (i = 0; i < G_N_ELEMENTS (texts); i ++) {
+    const gsize len = strlen (texts[i]);
+
+    for (m = 0; m < G_N_ELEMENTS (count_modes); m ++) {
+      const gsize total = tl_count_weighted_characters (texts[i], count_modes[m]);
+      const char *p;
+      gsize w, last_offset = 0;
+
+      index = tl_position_index_new (texts[i], len, count_modes[m]);
+      g_assert_cmpint (tl_position_index_get_weighted_length (index, 0, len), ==, total);
+
+      for (p = texts[i]; ; p = g_utf8_next_char (p)) {
+        const gsize character = g_utf8_pointer_to_offset (texts[i], p);
+
+        g_assert_cmpint (tl_position_index_get_character_for_byte_offset (index, p - texts[i]), ==, character);
+        g_assert_cmpint (tl_position_index_get_byte_offset_for_character (index, character), ==, p - texts[i]);
+        g_assert_cmpint (tl_position_index_get_weighted_length (index, 0, p - texts[i]) +
+                         tl_position_index_get_weighted_length (index, p - texts[i], len), <=, total);
+
+        if (*p == '\0') {
+          break;
+        }
+      }
+
+      for (w = 0; w <= total; w ++) {
+        const gsize offset = tl_position_index_get_byte_offset_for_weighted (index, w);
+
+        g_assert_cmpint (offset, >=, last_offset);
+        g_assert_cmpint (tl_position_index_get_weighted_length (index, 0, offset), <=, w);
+        last_offset = offset;
+      }
+      g_assert_cmpint (last_offset, ==, len);
+
+      tl_position_index_free (index);
+    }
+  }
+
+  // Links count as a whole, and only in full
+  index = tl_position_index_new (texts[2], strlen (texts[2]), COUNT_SHORT_URLS);
+  g_assert_cmpint (tl_position_index_get_weighted_length (index, 0, 4), ==, 4);
+  g_assert_cmpint (tl_position_index_get_weighted_length (index, 0, 8), ==, 4);
+  g_assert_cmpint (tl_position_index_get_weighted_length (index, 0, 20), ==, 4 + 23);
+  g_assert_cmpint (tl_position_index_get_weighted_length (index, 8, 24), ==, 4);
+  g_assert_cmpint (tl_position_index_get_byte_offset_for_weighted (index, 10), ==, 4);
+  g_assert_cmpint (tl_position_index_get_byte_offset_for_weighted (index, 28), ==, 21);
+  tl_position_index_free (index);
+}
+
+static void
+count_all (void)
+{
+  const char *texts[] = {
+    "",
+    "plain text",
+    "abc example.com/path def",
+    "🤦🏼‍♂️ ZWJ 👨‍👩‍👧‍👦 and Café @user #tag https://a.co/b",
+    "日本語のテキストと a.co",
+    "Cafe\u0301 at example.org",
+    "ab.cd}fooé👩‍💼{",
+  };
+  TlCounts counts;
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (texts); i ++) {
+    tl_count_all (texts[i], strlen (texts[i]), &counts);
+
+    g_assert_cmpint (counts.characters, ==, tl_count_characters (texts[i]));
+    g_assert_cmpint (counts.weighted_basic, ==, tl_count_weighted_characters (texts[i], COUNT_BASIC));
+    g_assert_cmpint (counts.weighted_short_urls, ==, tl_count_weighted_characters (texts[i], COUNT_SHORT_URLS));
+    g_assert_cmpint (counts.weighted_compact, ==, tl_count_weighted_characters (texts[i], COUNT_COMPACT));
+  }
+
+  // The link is found whether the emoji after it are compacted or not
+  g_assert_cmpint (counts.weighted_short_urls, ==, 23 + 1 + 3 + 1 + 2 + 1 + 2 + 1);
+  g_assert_cmpint (counts.weighted_compact, ==, 23 + 1 + 3 + 1 + 2 + 1);
+}
+
+static void
+utf16 (void)
+{
+  const char *texts[] = {
+    "",
+    "plain text",
+    "abc example.com/path def",
+    "🤦🏼‍♂️ ZWJ 👨‍👩‍👧‍👦 and Café @user #tag https://a.co/b",
+    "日本語のテキストと a.co",
+    "Cafe\u0301 at example.org",
+  };
+  const guint count_modes[] = { COUNT_BASIC, COUNT_SHORT_URLS, COUNT_COMPACT };
+  const gunichar2 unpaired[] = { 'a', 0xD83D, ' ', 0xDE00, 'b' };
+  GString *long_text = g_string_new (NULL);
+  guint i, m;
+
+  // Longer than the buffer, with and without whitespace
+  for (i = 0; i < 600; i ++) {
+    g_string_append (long_text, i % 200 == 0 ? "😀 " : "😀a.co");
+  }
+
+  for (i = 0; i <= G_N_ELEMENTS (texts); i ++) {
+    const char *text = i < G_N_ELEMENTS (texts) ? texts[i] : long_text->str;
+    glong length_in_units;
+    gunichar2 *input = g_utf8_to_utf16 (text, -1, NULL, &length_in_units, NULL);
+
+    g_assert_cmpint (tl_count_characters_utf16 (input, length_in_units), ==, tl_count_characters (text));
+
+    for (m = 0; m < G_N_ELEMENTS (count_modes); m ++) {
+      g_assert_cmpint (tl_count_weighted_characters_utf16 (input, length_in_units, count_modes[m]), ==,
+                       tl_count_weighted_characters (text, count_modes[m]));
+    }
+
+    g_free (input);
+  }
+
+  // Unpaired surrogates count as one character each
+  g_assert_cmpint (tl_count_characters_utf16 (unpaired, G_N_ELEMENTS (unpaired)), ==, 5);
+  g_assert_cmpint (tl_count_characters_utf16 (NULL, 0), ==, 0);
+
+  g_string_free (long_text, TRUE);
+}
+
 int
 main (int argc, char **argv)
 {
   g_test_init (&argc, &argv, NULL);
 
-  g_assert (GTLDS[G_N_ELEMENTS (GTLDS) - 1].length >= CCTLDS[G_N_ELEMENTS (CCTLDS) - 1].length);
-
 #ifdef LIBTL_DEBUG
   g_setenv ("G_MESSAGES_DEBUG", "libtl", TRUE);
 #endif
 
+  g_test_add_func ("/length/concurrent-first-calls", concurrent_first_calls);
   g_test_add_func ("/length/empty", empty);
   g_test_add_func ("/length/nonempty", nonempty);
   g_test_add_func ("/length/basic-links", basic_links);
   g_test_add_func ("/length/advanced-links", advanced_links);
   g_test_add_func ("/length/utf8", utf8);
+  g_test_add_func ("/length/normalization", normalization);
   g_test_add_func ("/length/validate", validate);
   g_test_add_func ("/length/emoji", emoji);
   g_test_add_func ("/length/cawbird-bug114", cawbird_bug_114);
+  g_test_add_func ("/length/long-dotted-runs", long_dotted_runs);
+  g_test_add_func ("/length/tld-table", tld_table);
+  g_test_add_func ("/length/long-text", long_text);
+  g_test_add_func ("/length/fits-within", fits_within);
+  g_test_add_func ("/length/truncation-offset", truncation_offset);
+  g_test_add_func ("/length/plain-text", plain_text);
+  g_test_add_func ("/length/batch", batch);
+  g_test_add_func ("/length/editor", editor);
+  g_test_add_func ("/length/position-index", position_index);
+  g_test_add_func ("/length/count-all", count_all);
+  g_test_add_func ("/length/utf16", utf16);
 
   return g_test_run ();
 }